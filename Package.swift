@@ -21,6 +21,7 @@ let package = Package(
         .target(
             name: "Futures",
             dependencies: [
+                "FuturesPrivate",
                 "FuturesSync",
             ]
         ),
@@ -41,6 +42,10 @@ let package = Package(
                 "FuturesSync",
             ]
         ),
+        .target(
+            name: "FuturesAllocationCounter",
+            dependencies: []
+        ),
 
         .testTarget(
             name: "FuturesTests",
@@ -56,5 +61,13 @@ let package = Package(
                 "FuturesTestSupport",
             ]
         ),
+        .testTarget(
+            name: "FuturesAllocationTests",
+            dependencies: [
+                "Futures",
+                "FuturesAllocationCounter",
+                "FuturesTestSupport",
+            ]
+        ),
     ]
 )
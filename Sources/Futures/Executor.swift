@@ -5,6 +5,7 @@
 //  Copyright © 2019 Akis Kesoglou. Licensed under the MIT license.
 //
 
+import FuturesPrivate
 import FuturesSync
 
 /// A protocol that defines objects that execute futures.
@@ -64,6 +65,15 @@ public protocol ExecutorProtocol: AnyObject {
     /// `isUnbounded`.
     var capacity: Int { get }
 
+    /// Returns a boolean denoting whether the calling code is being run by
+    /// this executor.
+    ///
+    /// Futures that target the executor that is already running them, via
+    /// `then(on:)` or `poll(on:)`, are run inline instead of being submitted
+    /// to it; see `InlineExecution`. Executors that cannot tell return
+    /// `false`, which is the default.
+    var isCurrent: Bool { get }
+
     /// Submits a future to be executed by this executor.
     ///
     /// The executor may deny to receive the future, in which case the
@@ -84,6 +94,18 @@ extension ExecutorProtocol {
         return capacity == Int.max
     }
 
+    @inlinable
+    public var isCurrent: Bool {
+        return false
+    }
+
+    /// Returns a boolean denoting whether a future that targets this
+    /// executor can be run inline by the caller.
+    @inlinable
+    var _canRunInline: Bool {
+        return InlineExecution.depth < InlineExecution.maxDepth && isCurrent
+    }
+
     /// Submits a future to be executed by this executor.
     @inlinable
     public func submit<F: FutureProtocol>(_ future: F) throws where F.Output == Void {
@@ -170,6 +192,47 @@ extension ExecutorProtocol where Failure == Never {
 
 // MARK: -
 
+/// Controls running futures inline, instead of submitting them, when they
+/// target the executor that is already running the calling code.
+///
+/// `then(on:)`, `poll(on:)` and their stream counterparts normally submit
+/// work to the target executor and wait to be woken up when it's done,
+/// which costs a full scheduling round-trip. When the caller is already
+/// being run by the target executor (see `ExecutorProtocol.isCurrent`),
+/// the hop is a no-op and the work is polled in place instead.
+///
+/// Each inline run nests within the caller's stack frame. Once `maxDepth`
+/// inline runs are nested on a thread, further ones are submitted to the
+/// executor as usual, which unwinds the stack.
+public enum InlineExecution {
+    /// The maximum number of nested inline runs on a thread. Set it to 0 to
+    /// always submit to the target executor. Should be set before any
+    /// futures are run, as it is read without synchronization.
+    public static var maxDepth = 16
+
+    /// The number of nested inline runs on the current thread.
+    @usableFromInline
+    static var depth: Int {
+        get {
+            return CThreadRuntimeGetCurrent().pointee.inlineDepth
+        }
+        set {
+            CThreadRuntimeGetCurrent().pointee.inlineDepth = newValue
+        }
+    }
+
+    /// Invokes `body` one level deeper into inline execution.
+    @inlinable
+    @inline(__always)
+    static func _run<R>(_ body: () throws -> R) rethrows -> R {
+        depth += 1
+        defer { depth -= 1 }
+        return try body()
+    }
+}
+
+// MARK: -
+
 /// A protocol that defines an object that can synchronously drive futures
 /// to completion and can be waited on until it's empty.
 ///
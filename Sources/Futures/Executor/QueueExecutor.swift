@@ -46,6 +46,7 @@ public final class QueueExecutor: ExecutorProtocol, Cancellable {
         _queue = queue
         _runner = .init(label: queue.label)
         _waker = .init(queue)
+        queue.setSpecific(key: _queueExecutorKey, value: ObjectIdentifier(self))
         _waker.setSignalHandler { [weak self] in
             guard let self = self else {
                 return true
@@ -85,6 +86,12 @@ public final class QueueExecutor: ExecutorProtocol, Cancellable {
         return Int.max
     }
 
+    /// Returns a boolean denoting whether the calling code is running on
+    /// the executor's queue.
+    public var isCurrent: Bool {
+        return DispatchQueue.getSpecific(key: _queueExecutorKey) == ObjectIdentifier(self)
+    }
+
     /// Schedules the given future to be executed by this executor.
     ///
     /// This method can be called from any thread.
@@ -161,6 +168,9 @@ extension QueueExecutor {
 
 // MARK: - Private -
 
+/// Identifies the executor that owns a queue; see `QueueExecutor.isCurrent`.
+private let _queueExecutorKey = DispatchSpecificKey<ObjectIdentifier>()
+
 @usableFromInline
 final class _QueueWaker: WakerProtocol {
     private let _source: DispatchSourceUserDataAdd
@@ -5,7 +5,7 @@
 //  Copyright © 2019 Akis Kesoglou. Licensed under the MIT license.
 //
 
-import class Dispatch.DispatchSemaphore
+import FuturesPrivate
 import FuturesSync
 
 public func assertOnThreadExecutor(_ executor: ThreadExecutor) {
@@ -38,9 +38,9 @@ public func assertOnThreadExecutor(_ executor: ThreadExecutor) {
 ///
 /// Each thread automatically gets an unbounded `ThreadExecutor` instance that
 /// is accessed via the `current` static property. Instances are lazily created
-/// on first access and are stored in a thread local via `pthreads`. Note that
-/// your code must still ensure it regularly calls `run()` or one of the `wait`
-/// methods to run the executor.
+/// on first access and are stored in native thread-local storage, via
+/// `ThreadRuntime`. Note that your code must still ensure it regularly calls
+/// `run()` or one of the `wait` methods to run the executor.
 ///
 /// `ThreadExecutor` is safe to use from one thread only, which is typically
 /// the thread that created the instance. Submitting futures into the executor
@@ -100,19 +100,18 @@ public final class ThreadExecutor: BlockingExecutor {
 
 // MARK: Default executors
 
-@usableFromInline let _currentThreadExecutor = ThreadLocal {
-    ThreadExecutor()
-}
-
 extension ThreadExecutor {
     @inlinable
     public static var current: ThreadExecutor {
-        _currentThreadExecutor.value
+        ThreadRuntime.executor(ThreadExecutor.self) { ThreadExecutor() }
     }
 
+    /// Returns a boolean denoting whether this is the current thread's
+    /// executor. Unlike comparing with `current`, this never creates an
+    /// executor for the thread.
     @inlinable
     public var isCurrent: Bool {
-        Self.current === self
+        CThreadRuntimeGetCurrent().pointee.executor == Unmanaged.passUnretained(self).toOpaque()
     }
 }
 
@@ -120,70 +119,44 @@ extension ThreadExecutor {
 
 @usableFromInline
 final class _ThreadWaker: WakerProtocol {
-    @usableFromInline static let IDLE: UInt = 0
-    @usableFromInline static let PARKED: UInt = 1
-    @usableFromInline static let NOTIFIED: UInt = 2
-
-    // used to prevent spurious wakeups due to the semaphore's value
-    // accumulating via multiple signals by effectively coalescing them
-    @usableFromInline var _state: AtomicUInt.RawValue = 0
+    // coalesces multiple signals into a single wakeup
+    @usableFromInline var _notified: AtomicBool.RawValue = false
 
     // used to park/unpark the thread
-    @usableFromInline let _semaphore = DispatchSemaphore(value: 0)
+    @usableFromInline let _event = EventCount()
 
     @inlinable
     init() {
-        AtomicUInt.initialize(&_state, to: Self.IDLE)
+        AtomicBool.initialize(&_notified, to: false)
     }
 
     @inlinable
     func signal() {
-        switch AtomicUInt.exchange(&_state, Self.NOTIFIED) {
-        case Self.NOTIFIED:
+        if AtomicBool.exchange(&_notified, true) {
             // ignore this one; already signalled
             return
-
-        case Self.IDLE:
-            // ignore this one as well; `wait()` will observe
-            // the notification and not block at all
-            return
-
-        case Self.PARKED:
-            _semaphore.signal()
-
-        default:
-            fatalError("unreachable")
         }
+        // free unless the thread is blocked in, or about to block in, `wait()`
+        _event.notifyOne()
     }
 
     @inlinable
     func wait() {
-        switch AtomicUInt.compareExchange(&_state, Self.IDLE, Self.PARKED) {
-        case Self.NOTIFIED:
-            // already signalled; no need to block,
-            // just consume the notification
-            let prev = AtomicUInt.exchange(&_state, Self.IDLE)
-            assert(prev == Self.NOTIFIED)
-            return
-
-        case Self.IDLE:
-            // not signalled yet; block the thread.
-            // There's potential for a race condition here that the counting
-            // semaphore protects us against: after we changed the state above
-            // and by the time we get to block the thread, someone may call
-            // `signal()` on us and that notification would be lost. The
-            // semaphore however "remembers" this signal and attempting to
-            // wait on it results in `wait()` consuming that signal and
-            // immediately returning (which is pretty much identical behavior
-            // to what we do here as well).
-            _semaphore.wait()
-
-            while Self.NOTIFIED != AtomicUInt.compareExchange(&_state, Self.NOTIFIED, Self.IDLE) {
-                Atomic.hardwarePause()
+        while true {
+            if AtomicBool.exchange(&_notified, false) {
+                // already signalled; no need to block,
+                // just consume the notification
+                return
             }
-
-        default:
-            fatalError("unreachable")
+            // Announce that we're about to block and check again; if
+            // `signal()` is called after this point, it either sets
+            // the flag before we check it or wakes us up.
+            let key = _event.prepareWait()
+            if AtomicBool.exchange(&_notified, false) {
+                _event.cancelWait()
+                return
+            }
+            _event.commitWait(key)
         }
     }
 }
@@ -98,36 +98,43 @@ public enum Future {}
 /// You can also use `AnyFuture` to create a custom future by providing a
 /// closure for the `poll` method, rather than implementing `FutureProtocol`
 /// directly on a custom type.
+///
+/// Futures of up to three words in size are stored inline; erasing them
+/// does not allocate. Like the futures it wraps, `AnyFuture` has value
+/// semantics; polling a copy does not affect the original.
+///
+/// - Important: This is a breaking change. Copies of `AnyFuture` used to share
+///     the wrapped future, so polling one copy advanced all of them. Code
+///     that relied on this must now share a single instance instead, e.g.
+///     by storing it in a class. Futures created from a closure
+///     still share whatever state the closure captures.
 public struct AnyFuture<Output>: FutureProtocol {
     public typealias PollFn = (inout Context) -> Poll<Output>
 
-    @usableFromInline let _pollFn: PollFn
+    @usableFromInline var _storage: _AnyFutureStorage
 
     /// Creates a type-erasing future implemented by the provided closure.
     @inlinable
     public init(_ pollFn: @escaping PollFn) {
-        _pollFn = pollFn
+        _storage = _ErasedPollFn(pollFn)
     }
 
     /// Creates a type-erasing future to wrap the provided future.
     ///
-    /// This initializer performs a heap allocation unless the wrapped future
-    /// is already type-erased.
+    /// This initializer performs a heap allocation if the wrapped future
+    /// is larger than three words, unless it is already type-erased.
     @inlinable
     public init<F: FutureProtocol>(_ future: F) where F.Output == Output {
         if let f = future as? AnyFuture {
-            _pollFn = f._pollFn
+            self = f
         } else {
-            var f = future
-            _pollFn = {
-                f.poll(&$0)
-            }
+            _storage = _ErasedFuture(future)
         }
     }
 
     @inlinable
-    public func poll(_ context: inout Context) -> Poll<Output> {
-        return _pollFn(&context)
+    public mutating func poll(_ context: inout Context) -> Poll<Output> {
+        return _storage._poll(&context)
     }
 }
 
@@ -7,13 +7,14 @@
 
 extension Future._Private {
     public enum PollOn<E: ExecutorProtocol, Base: FutureProtocol> {
-        case pending(Promise<Base.Output>, E, Base)
+        case pending(E, Base)
+        case inline(Base)
         case waiting(Promise<Base.Output>, E)
         case done
 
         @inlinable
         public init(base: Base, executor: E) {
-            self = .pending(.init(), executor, base)
+            self = .pending(executor, base)
         }
     }
 }
@@ -25,7 +26,13 @@ extension Future._Private.PollOn: FutureProtocol {
     public mutating func poll(_ context: inout Context) -> Poll<Output> {
         while true {
             switch self {
-            case .pending(let promise, let executor, let base):
+            case .pending(let executor, let base):
+                if executor._canRunInline {
+                    // already running on the executor; poll in place
+                    self = .inline(base)
+                    continue
+                }
+                let promise = Promise<Base.Output>()
                 let resolver = promise.resolve(when: base)
                 switch executor.trySubmit(resolver) {
                 case .success:
@@ -37,6 +44,19 @@ extension Future._Private.PollOn: FutureProtocol {
                     return .ready(.failure(error))
                 }
 
+            case .inline(var base):
+                let result = InlineExecution._run {
+                    base.poll(&context)
+                }
+                switch result {
+                case .ready(let output):
+                    self = .done
+                    return .ready(.success(output))
+                case .pending:
+                    self = .inline(base)
+                    return .pending
+                }
+
             case .waiting(let promise, _):
                 switch promise.poll(&context) {
                 case .ready(let output):
@@ -22,6 +22,7 @@ extension Future._Private {
         }
 
         case pending(Base, E, Continuation)
+        case inline(U.FutureType)
         case waiting(Task<U.FutureType.Output>)
         case done
 
@@ -82,6 +83,12 @@ extension Future._Private.Then: FutureProtocol {
             case .pending(var base, let executor, let continuation):
                 switch base.poll(&context) {
                 case .ready(let output):
+                    if executor._canRunInline {
+                        // already running on the executor; continue in place
+                        self = .inline(continuation(output).makeFuture())
+                        continue
+                    }
+
                     let future = Inner(
                         output: output,
                         continuation: continuation
@@ -101,6 +108,19 @@ extension Future._Private.Then: FutureProtocol {
                     return .pending
                 }
 
+            case .inline(var future):
+                let result = InlineExecution._run {
+                    future.poll(&context)
+                }
+                switch result {
+                case .ready(let output):
+                    self = .done
+                    return .ready(.success(output))
+                case .pending:
+                    self = .inline(future)
+                    return .pending
+                }
+
             case .waiting(let task):
                 switch task.poll(&context) {
                 case .ready(.success(let output)):
@@ -5,104 +5,129 @@
 //  Copyright © 2019 Akis Kesoglou. Licensed under the MIT license.
 //
 
-/// A FIFO queue, backed by a contiguous array, that is fast to dequeue
-/// elements while also maintaining control over the overall allocated
-/// capacity.
+/// A FIFO queue, backed by a ring of uninitialized storage, that is fast to
+/// dequeue elements while also maintaining control over the overall
+/// allocated capacity.
 ///
 /// Like the native library's containers, it grows to accomodate new elements
 /// by doubling its capacity when they won't fit, but it also dynamically
 /// shrinks if the ratio of the number of elements over the whole capacity
 /// becomes small enough. AdaptiveQueue is especially useful for cases where
 /// the storage is long-lived and the load varying.
+///
+/// Storage is allocated lazily, on the first push, and is kept when the
+/// queue is drained with `moveElements()`, to be reused.
 @usableFromInline
 internal struct AdaptiveQueue<Element> {
-    @usableFromInline typealias _Buffer = ContiguousArray<Element?>
+    @usableFromInline typealias _Storage = _RingStorage<Element>
 
-    @usableFromInline var _buffer: _Buffer
-    @usableFromInline var _head: Int
+    @usableFromInline var _storage: _Storage?
 
     @inlinable
     internal init() {
-        _buffer = .init()
-        _head = 0
+        _storage = nil
     }
 
     @inlinable
     internal mutating func reserveCapacity(_ capacity: Int) {
-        _buffer.reserveCapacity(capacity)
+        if self.capacity < capacity {
+            _resizeStorage(capacity: capacity)
+        }
     }
 
     @inlinable
     internal var capacity: Int {
-        return _buffer.count
+        return _storage?.capacity ?? 0
     }
 
     @inlinable
     internal var count: Int {
-        return _buffer.count - _head
+        return _storage?.count ?? 0
     }
 
     @inlinable
     internal var isEmpty: Bool {
-        return _buffer.count == _head
-    }
-
-    @inlinable
-    internal mutating func move() -> AdaptiveQueue {
-        let queue = self
-        _buffer = .init()
-        _head = 0
-        return queue
+        return count == 0
     }
 
     @inlinable
     internal mutating func moveElements() -> [Element] {
-        return .init(IteratorSequence(move()))
+        if isKnownUniquelyReferenced(&_storage) {
+            // swiftlint:disable:next force_unwrapping
+            return _storage!.moveElements()
+        }
+        guard let storage = _storage.move() else {
+            return []
+        }
+        return storage.copyElements(maxCount: storage.count)
     }
 
     @inlinable
     @inline(__always)
     internal func forEach(_ body: (Element) throws -> Void) rethrows {
-        for case let element? in _buffer {
-            try body(element)
-        }
+        try _storage?.forEach(body)
     }
 
     @inlinable
     internal mutating func push(_ item: Element) {
-        if let itemCount = _adjustedCapacity() {
-            _resizeBuffer(capacity: itemCount)
-        }
-        _buffer.append(item)
+        _reserve(1)
+        // swiftlint:disable:next force_unwrapping
+        _storage!.push(item)
     }
 
     @inlinable
     internal mutating func push<S: Sequence>(_ s: S) where S.Element == Element {
-        if let itemCount = _adjustedCapacity(extra: s.underestimatedCount) {
-            _resizeBuffer(capacity: itemCount)
+        _reserve(s.underestimatedCount)
+        // swiftlint:disable:next force_unwrapping
+        var iterator = _storage!.push(contentsOf: s)
+        while let item = iterator.next() {
+            push(item)
         }
-        _buffer.append(contentsOf: s.lazy.map(Optional.some))
     }
 
     @inlinable
     internal mutating func pop() -> Element? {
-        if isEmpty {
+        guard count > 0 else {
             return nil
         }
-        defer { _head += 1 }
-        return _buffer[_head].move()
+        if !isKnownUniquelyReferenced(&_storage) {
+            _resizeStorage(capacity: capacity)
+        }
+        // swiftlint:disable:next force_unwrapping
+        return _storage!.pop()
     }
 
+    /// Makes sure that the storage is uniquely referenced and has room for
+    /// `extra` more elements, growing or shrinking it as needed.
     @inlinable
     @inline(__always)
-    mutating func _adjustedCapacity(extra: Int = 0) -> Int? {
+    mutating func _reserve(_ extra: Int) {
+        if let itemCount = _adjustedCapacity(extra: extra) {
+            _resizeStorage(capacity: itemCount)
+        } else if !isKnownUniquelyReferenced(&_storage) {
+            _resizeStorage(capacity: capacity)
+        }
+    }
+
+    @inlinable
+    @inline(__always)
+    func _adjustedCapacity(extra: Int = 0) -> Int? {
+        guard let storage = _storage else {
+            return max(extra, 1)
+        }
+        let count = storage.count
+        let capacity = storage.capacity
+        if count + extra > capacity {
+            return max((count + extra) * 2, capacity * 2)
+        }
         let itemCount = max(count + extra, 1)
-        if _buffer.count == _buffer.capacity, _buffer.count / itemCount >= 4 {
-            // We are going to do an allocation anyway, so instead of letting
-            // the buffer grow unbounded, check to see whether we can reclaim
-            // some memory by purging read entries (i.e. `nil`). If the number
-            // of read entries became the majority by 4, reallocate the
-            // storage with half the current capacity.
+        if storage.withUnsafeMutablePointerToHeader({ $0.pointee.writeIndex & $0.pointee.mask }) == 0,
+            capacity / itemCount >= 4 {
+            // Writing wraps around once for every `capacity` elements pushed,
+            // so instead of letting the storage stay large after a burst,
+            // check to see whether we can reclaim some memory at that point.
+            // If free slots became the majority by 4, reallocate the storage
+            // with half the current capacity, or less.
             return itemCount * 2
         }
         return nil // no need to adjust
@@ -110,12 +135,16 @@ internal struct AdaptiveQueue<Element> {
 
     @usableFromInline
     @inline(never)
-    mutating func _resizeBuffer(capacity: Int) {
-        var storage = _Buffer()
-        storage.reserveCapacity(capacity)
-        storage.append(contentsOf: _buffer[_head..<_buffer.count])
-        _buffer = storage
-        _head = 0
+    mutating func _resizeStorage(capacity: Int) {
+        let isUnique = isKnownUniquelyReferenced(&_storage)
+        guard let storage = _storage else {
+            _storage = .create(capacity: capacity)
+            return
+        }
+        let capacity = max(capacity, storage.count)
+        _storage = isUnique
+            ? storage.moveToStorage(capacity: capacity)
+            : storage.copyToStorage(capacity: capacity)
     }
 }
 
@@ -7,42 +7,21 @@
 
 @usableFromInline
 internal struct CircularBuffer<Element> {
-    @usableFromInline typealias _Buffer = ContiguousArray<Element?>
+    @usableFromInline typealias _Storage = _RingStorage<Element>
 
-    @usableFromInline var _buffer: _Buffer
+    @usableFromInline var _storage: _Storage
     @usableFromInline let _capacity: Int
-    @usableFromInline var _head: Int // write pointer
-    @usableFromInline var _tail: Int // read pointer
-
-    @inlinable
-    var _bufferCapacity: Int {
-        return _buffer.count
-    }
-
-    @inlinable
-    var _mask: Int {
-        return _bufferCapacity - 1
-    }
 
     @inlinable
     internal init(capacity: Int) {
         let capacity = Int(UInt32(capacity))
-        _buffer = .init(repeating: nil, count: nextPowerOf2(capacity))
+        _storage = .create(capacity: capacity)
         _capacity = capacity
-        _head = 0
-        _tail = 0
-    }
-
-    @inlinable
-    internal mutating func destroy() {
-        _buffer = .init()
-        _head = 0
-        _tail = 0
     }
 
     @inlinable
     internal var count: Int {
-        return _head - _tail
+        return _storage.count
     }
 
     @inlinable
@@ -52,21 +31,17 @@ internal struct CircularBuffer<Element> {
 
     @inlinable
     internal var isEmpty: Bool {
-        return _head == _tail
-    }
-
-    @inlinable
-    internal mutating func move() -> CircularBuffer {
-        let queue = self
-        _buffer = .init(repeating: nil, count: _bufferCapacity)
-        _head = 0
-        _tail = 0
-        return queue
+        return count == 0
     }
 
     @inlinable
     internal mutating func moveElements() -> [Element] {
-        return .init(IteratorSequence(move()))
+        if isKnownUniquelyReferenced(&_storage) {
+            return _storage.moveElements()
+        }
+        let elements = _storage.copyElements(maxCount: count)
+        _storage = .create(capacity: _storage.capacity)
+        return elements
     }
 
     @inlinable
@@ -76,18 +51,7 @@ internal struct CircularBuffer<Element> {
 
     @inlinable
     internal func prefix(_ maxCount: Int) -> [Element] {
-        var elements = [Element]()
-        elements.reserveCapacity(maxCount)
-        var count = maxCount
-        var tail = _tail
-        while tail < _head, count > 0 {
-            if let element = _buffer[tail & _mask] {
-                count -= 1
-                elements.append(element)
-            }
-            tail += 1
-        }
-        return elements
+        return _storage.copyElements(maxCount: maxCount)
     }
 
     @inlinable
@@ -95,50 +59,43 @@ internal struct CircularBuffer<Element> {
         if count == capacity {
             return false
         }
-        _buffer[_head & _mask] = element
-        _head += 1
+        _makeUnique()
+        _storage.push(element)
         return true
     }
 
+    /// Pushes `element`. If the buffer is full, it either grows to make
+    /// room or, if `expand` is false, drops its oldest element.
     @inlinable
     internal mutating func push(_ element: Element, expand: Bool = true) {
-        if count == _bufferCapacity {
-            if expand {
-                _adjustCapacity()
-            } else {
-                _tail += 1
+        _makeUnique()
+        if expand {
+            if count == _storage.capacity {
+                _storage = _storage.moveToStorage(capacity: _storage.capacity << 1)
             }
+        } else if capacity == 0 {
+            return
+        } else if count == capacity {
+            _ = _storage.pop()
         }
-        _buffer[_head & _mask] = element
-        _head += 1
+        _storage.push(element)
     }
 
     @inlinable
     internal mutating func pop() -> Element? {
         if isEmpty {
-            _head = 0
-            _tail = 0
             return nil
         }
-        defer { _tail += 1 }
-        return _buffer[_tail & _mask].move()
+        _makeUnique()
+        return _storage.pop()
     }
 
-    @usableFromInline
-    @inline(never)
-    mutating func _adjustCapacity() {
-        var storage: _Buffer = []
-        let newCapacity = _bufferCapacity << 1
-        let head = _tail & _mask
-        storage.reserveCapacity(newCapacity)
-        storage.append(contentsOf: _buffer[head..<_bufferCapacity])
-        if head > 0 {
-            storage.append(contentsOf: _buffer[0..<head])
+    @inlinable
+    @inline(__always)
+    mutating func _makeUnique() {
+        if !isKnownUniquelyReferenced(&_storage) {
+            _storage = _storage.copyToStorage(capacity: _storage.capacity)
         }
-        storage.append(contentsOf: repeatElement(nil, count: newCapacity - storage.count))
-        _head = _bufferCapacity
-        _tail = 0
-        _buffer = storage
     }
 }
 
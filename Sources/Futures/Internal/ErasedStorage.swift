@@ -0,0 +1,94 @@
+//
+//  ErasedStorage.swift
+//  Futures
+//
+//  Copyright © 2019 Akis Kesoglou. Licensed under the MIT license.
+//
+
+// Storage for `AnyFuture` and `AnyStream`.
+//
+// Erased futures and streams are kept in a protocol existential, rather than
+// captured by a closure. An existential stores values of up to three words
+// inline, so erasing small futures and streams (such as `Future.ready()`, or
+// a `map` over one with a non-capturing closure) does not allocate; larger
+// ones are boxed on the heap. Either way, the existential's witness tables
+// serve as the vtable that copies, destroys and polls the value.
+//
+// The protocols can't refer to the output type via an associated type, as
+// that would prevent them from being used as existentials. Instead, polling
+// is generic over the output type, which callers guarantee is the output
+// type of the wrapped future or stream.
+
+@usableFromInline
+protocol _AnyFutureStorage {
+    mutating func _poll<T>(_ context: inout Context) -> Poll<T>
+}
+
+@usableFromInline
+struct _ErasedFuture<F: FutureProtocol>: _AnyFutureStorage {
+    @usableFromInline var _base: F
+
+    @inlinable
+    init(_ base: F) {
+        _base = base
+    }
+
+    @inlinable
+    mutating func _poll<T>(_ context: inout Context) -> Poll<T> {
+        assert(T.self == F.Output.self)
+        return unsafeBitCast(_base.poll(&context), to: Poll<T>.self)
+    }
+}
+
+@usableFromInline
+struct _ErasedPollFn<Output>: _AnyFutureStorage {
+    @usableFromInline let _pollFn: (inout Context) -> Poll<Output>
+
+    @inlinable
+    init(_ pollFn: @escaping (inout Context) -> Poll<Output>) {
+        _pollFn = pollFn
+    }
+
+    @inlinable
+    mutating func _poll<T>(_ context: inout Context) -> Poll<T> {
+        assert(T.self == Output.self)
+        return unsafeBitCast(_pollFn(&context), to: Poll<T>.self)
+    }
+}
+
+@usableFromInline
+protocol _AnyStreamStorage {
+    mutating func _pollNext<T>(_ context: inout Context) -> Poll<T?>
+}
+
+@usableFromInline
+struct _ErasedStream<S: StreamProtocol>: _AnyStreamStorage {
+    @usableFromInline var _base: S
+
+    @inlinable
+    init(_ base: S) {
+        _base = base
+    }
+
+    @inlinable
+    mutating func _pollNext<T>(_ context: inout Context) -> Poll<T?> {
+        assert(T.self == S.Output.self)
+        return unsafeBitCast(_base.pollNext(&context), to: Poll<T?>.self)
+    }
+}
+
+@usableFromInline
+struct _ErasedPollNextFn<Output>: _AnyStreamStorage {
+    @usableFromInline let _pollNextFn: (inout Context) -> Poll<Output?>
+
+    @inlinable
+    init(_ pollNextFn: @escaping (inout Context) -> Poll<Output?>) {
+        _pollNextFn = pollNextFn
+    }
+
+    @inlinable
+    mutating func _pollNext<T>(_ context: inout Context) -> Poll<T?> {
+        assert(T.self == Output.self)
+        return unsafeBitCast(_pollNextFn(&context), to: Poll<T?>.self)
+    }
+}
@@ -0,0 +1,216 @@
+//
+//  RingStorage.swift
+//  Futures
+//
+//  Copyright © 2019 Akis Kesoglou. Licensed under the MIT license.
+//
+
+@usableFromInline
+struct _RingStorageHeader {
+    @usableFromInline let mask: Int
+    @usableFromInline var readIndex: Int = 0
+    @usableFromInline var writeIndex: Int = 0
+
+    @inlinable
+    init(mask: Int) {
+        self.mask = mask
+    }
+}
+
+// Uninitialized storage for a ring of elements, shared by `AdaptiveQueue`
+// and `CircularBuffer`.
+//
+// Only the slots between `readIndex` and `writeIndex` are initialized.
+// Indices increase monotonically and wrap around on overflow; the storage
+// capacity is a power of 2 so that they can be mapped to slots with a mask.
+// The initialized slots therefore form at most two contiguous regions, which
+// lets elements be moved in and out in bulk.
+//
+// All mutating methods assume that the storage is uniquely referenced; the
+// containers built on it are responsible for copying it on write.
+@usableFromInline
+final class _RingStorage<Element>: ManagedBuffer<_RingStorageHeader, Element> {
+    /// Creates storage for `capacity` elements, rounded up to a power of 2.
+    @inlinable
+    static func create(capacity: Int) -> _RingStorage {
+        let capacity = nextPowerOf2(capacity)
+        let storage = create(minimumCapacity: capacity) { _ in
+            .init(mask: capacity - 1)
+        }
+        return unsafeDowncast(storage, to: _RingStorage.self)
+    }
+
+    @inlinable
+    deinit {
+        withUnsafeMutablePointers { header, elements in
+            _RingStorage._forEachRegion(header, elements) {
+                $0.deinitialize(count: $1)
+            }
+            header.deinitialize(count: 1)
+        }
+    }
+
+    @inlinable
+    var capacity: Int {
+        return withUnsafeMutablePointerToHeader {
+            $0.pointee.mask + 1
+        }
+    }
+
+    @inlinable
+    var count: Int {
+        return withUnsafeMutablePointerToHeader {
+            $0.pointee.writeIndex &- $0.pointee.readIndex
+        }
+    }
+
+    /// Appends `element`. The storage must not be full.
+    @inlinable
+    func push(_ element: Element) {
+        withUnsafeMutablePointers { header, elements in
+            let index = header.pointee.writeIndex
+            assert(index &- header.pointee.readIndex <= header.pointee.mask)
+            (elements + (index & header.pointee.mask)).initialize(to: element)
+            header.pointee.writeIndex = index &+ 1
+        }
+    }
+
+    /// Appends as many elements of `s` as fit in the free slots and returns
+    /// an iterator over the rest.
+    @inlinable
+    func push<S: Sequence>(contentsOf s: S) -> S.Iterator where S.Element == Element {
+        return withUnsafeMutablePointers { header, elements in
+            let mask = header.pointee.mask
+            let start = header.pointee.writeIndex & mask
+            let free = mask + 1 - (header.pointee.writeIndex &- header.pointee.readIndex)
+            let first = min(free, mask + 1 - start)
+            var (iterator, written) = UnsafeMutableBufferPointer(start: elements + start, count: first)
+                .initialize(from: s)
+            if written == first {
+                // wrap around to the start of the storage
+                while written < free, let element = iterator.next() {
+                    (elements + (written - first)).initialize(to: element)
+                    written += 1
+                }
+            }
+            header.pointee.writeIndex &+= written
+            return iterator
+        }
+    }
+
+    /// Removes and returns the oldest element, or `nil` if the storage is
+    /// empty.
+    @inlinable
+    func pop() -> Element? {
+        return withUnsafeMutablePointers { header, elements in
+            let index = header.pointee.readIndex
+            if index == header.pointee.writeIndex {
+                return nil
+            }
+            header.pointee.readIndex = index &+ 1
+            return (elements + (index & header.pointee.mask)).move()
+        }
+    }
+
+    /// Moves all elements out of the storage, oldest first, and leaves it
+    /// empty.
+    @inlinable
+    func moveElements() -> [Element] {
+        return withUnsafeMutablePointers { header, elements in
+            var result = [Element]()
+            result.reserveCapacity(header.pointee.writeIndex &- header.pointee.readIndex)
+            _RingStorage._forEachRegion(header, elements) {
+                result.append(contentsOf: UnsafeBufferPointer(start: $0, count: $1))
+                $0.deinitialize(count: $1)
+            }
+            header.pointee.readIndex = header.pointee.writeIndex
+            return result
+        }
+    }
+
+    /// Returns a copy of the oldest `maxCount` elements.
+    @inlinable
+    func copyElements(maxCount: Int) -> [Element] {
+        return withUnsafeMutablePointers { header, elements in
+            var result = [Element]()
+            result.reserveCapacity(min(maxCount, header.pointee.writeIndex &- header.pointee.readIndex))
+            _RingStorage._forEachRegion(header, elements) {
+                result.append(contentsOf: UnsafeBufferPointer(start: $0, count: min($1, maxCount - result.count)))
+            }
+            return result
+        }
+    }
+
+    @inlinable
+    func forEach(_ body: (Element) throws -> Void) rethrows {
+        try withUnsafeMutablePointers { header, elements in
+            try _RingStorage._forEachRegion(header, elements) {
+                try UnsafeBufferPointer(start: $0, count: $1).forEach(body)
+            }
+        }
+    }
+
+    /// Returns new storage for `capacity` elements, rounded up to a power
+    /// of 2, and moves all elements into it.
+    @usableFromInline
+    @inline(never)
+    func moveToStorage(capacity: Int) -> _RingStorage {
+        let storage = _RingStorage.create(capacity: capacity)
+        withUnsafeMutablePointers { header, elements in
+            let count = header.pointee.writeIndex &- header.pointee.readIndex
+            precondition(count <= storage.capacity)
+            storage.withUnsafeMutablePointers { newHeader, newElements in
+                var target = newElements
+                _RingStorage._forEachRegion(header, elements) {
+                    target.moveInitialize(from: $0, count: $1)
+                    target += $1
+                }
+                newHeader.pointee.writeIndex = count
+            }
+            header.pointee.readIndex = header.pointee.writeIndex
+        }
+        return storage
+    }
+
+    /// Returns new storage for `capacity` elements, rounded up to a power
+    /// of 2, with a copy of all elements.
+    @usableFromInline
+    @inline(never)
+    func copyToStorage(capacity: Int) -> _RingStorage {
+        let storage = _RingStorage.create(capacity: capacity)
+        withUnsafeMutablePointers { header, elements in
+            let count = header.pointee.writeIndex &- header.pointee.readIndex
+            precondition(count <= storage.capacity)
+            storage.withUnsafeMutablePointers { newHeader, newElements in
+                var target = newElements
+                _RingStorage._forEachRegion(header, elements) {
+                    target.initialize(from: $0, count: $1)
+                    target += $1
+                }
+                newHeader.pointee.writeIndex = count
+            }
+        }
+        return storage
+    }
+
+    /// Invokes `body` with the start and length of each contiguous region
+    /// of initialized slots, oldest first.
+    @inlinable
+    @inline(__always)
+    static func _forEachRegion(
+        _ header: UnsafeMutablePointer<_RingStorageHeader>,
+        _ elements: UnsafeMutablePointer<Element>,
+        _ body: (UnsafeMutablePointer<Element>, Int) throws -> Void
+    ) rethrows {
+        let mask = header.pointee.mask
+        let count = header.pointee.writeIndex &- header.pointee.readIndex
+        let start = header.pointee.readIndex & mask
+        let first = min(count, mask + 1 - start)
+        if first > 0 {
+            try body(elements + start, first)
+        }
+        if count > first {
+            try body(elements, count - first)
+        }
+    }
+}
@@ -5,6 +5,8 @@
 //  Copyright © 2019 Akis Kesoglou. Licensed under the MIT license.
 //
 
+import FuturesSync
+
 @usableFromInline
 final class _TaskRunner {
     /// A user-displayable identifier. Can be useful for debugging.
@@ -14,7 +16,7 @@ final class _TaskRunner {
 
     // Buffers futures that are submitted either externally via an executor
     // or internally by a future during polling via `Context`. On every tick,
-    // the buffer is flushed into the scheduler in one go.
+    // the buffer is drained into the scheduler, one future at a time.
     @usableFromInline var _incoming = AdaptiveQueue<AnyFuture<Void>>()
 
     @inlinable
@@ -47,10 +49,12 @@ final class _TaskRunner {
     @usableFromInline
     @discardableResult
     func run(_ context: inout Context) -> Bool {
+        MonotonicClock.refreshTickTime()
+
         if !_incoming.isEmpty {
             // Schedule futures that have been submitted externally
             // via an executor since the last tick
-            _futures.schedule(_incoming.moveElements())
+            _scheduleIncoming()
         }
 
         _futures.register(context.waker)
@@ -61,7 +65,7 @@ final class _TaskRunner {
             if !_incoming.isEmpty {
                 // New futures have been submitted by the future;
                 // schedule them and re-poll.
-                _futures.schedule(_incoming.moveElements())
+                _scheduleIncoming()
                 continue
             }
 
@@ -79,4 +83,13 @@ final class _TaskRunner {
             }
         }
     }
+
+    /// Moves futures from the incoming queue into the scheduler one at a
+    /// time, so that the queue's storage is reused and no intermediate
+    /// array is allocated.
+    private func _scheduleIncoming() {
+        while let future = _incoming.pop() {
+            _futures.schedule(future)
+        }
+    }
 }
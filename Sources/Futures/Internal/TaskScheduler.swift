@@ -24,9 +24,17 @@ final class _TaskScheduler<F: FutureProtocol> {
     }
 
     deinit {
+        // Return all nodes to the thread's free list in one go, so that
+        // schedulers created later on this thread, typically for the next
+        // request, reuse them instead of allocating their own.
         while let head = _head {
             _unlink(head)
-            _release(head, reusable: false)
+            if !_release(head, reusable: false) {
+                ReadyQueue.recycle(head)
+            }
+        }
+        while let node = _nodeCache.pop() {
+            ReadyQueue.recycle(node)
         }
     }
 
@@ -75,6 +83,9 @@ final class _TaskScheduler<F: FutureProtocol> {
                 // that the call to `release()` really happened and retry.
                 assert(node.nextActive == nil)
                 assert(node.prevActive == nil)
+                // The node is out of the ready-to-run queue now, so it can
+                // finally be reused.
+                _nodeCache.push(node)
                 continue
             }
 
@@ -128,14 +139,21 @@ final class _TaskScheduler<F: FutureProtocol> {
         _length -= 1
     }
 
-    private func _release(_ node: Node, reusable: Bool = true) {
+    /// Returns whether the node was enqueued in the ready-to-run queue.
+    ///
+    /// Nodes that were enqueued, typically because their future woke itself
+    /// before completing, are still linked in the ready-to-run queue and are
+    /// not cached; `pollNext()` caches them once it dequeues them.
+    @discardableResult
+    private func _release(_ node: Node, reusable: Bool = true) -> Bool {
         assert(node.nextActive == nil)
         assert(node.prevActive == nil)
-        node.enqueued(true)
+        let wasEnqueued = node.enqueued(true)
         node.future = nil
-        if reusable {
+        if reusable && !wasEnqueued {
             _nodeCache.push(node)
         }
+        return wasEnqueued
     }
 }
 
@@ -249,6 +267,13 @@ private final class _ReadyQueue<F: FutureProtocol> {
     }
 
     func makeNode(_ future: F) -> Node {
+        if let node = _ReadyQueue._takeRecycledNode() {
+            node.withUnsafeMutablePointerToHeader {
+                $0.pointee.queue = self
+                $0.pointee.future = future
+            }
+            return node
+        }
         let node = Node.create(minimumCapacity: 1) { _ in
             .init()
         }
@@ -261,6 +286,54 @@ private final class _ReadyQueue<F: FutureProtocol> {
         return unsafeDowncast(node, to: Node.self)
     }
 
+    /// Puts a released node that is not in any ready-to-run queue on the
+    /// current thread's free list, for any scheduler of the same type to
+    /// reuse.
+    static func recycle(_ node: Node) {
+        let freeList = _freeList
+        guard freeList.nodes.count < _NODE_FREE_LIST_CAPACITY else {
+            return
+        }
+        node.withUnsafeMutablePointers {
+            assert($0.pointee.future == nil)
+            assert(AtomicBool.load(&$0.pointee.enqueued))
+            $0.pointee.queue = nil
+            // Released nodes may still point to the node that followed them
+            // in the ready-to-run queue; drop that reference, so that nodes
+            // on the free list only reference each other via the list.
+            AtomicNode.store($1, nil, order: .relaxed)
+        }
+        freeList.nodes.append(node)
+    }
+
+    private static func _takeRecycledNode() -> Node? {
+        let freeList = _freeList
+        while var node = freeList.nodes.popLast() {
+            // Nodes are also wakers; skip those that are still referenced
+            // by a future that was polled with them, so that stale wakeups
+            // never reach a node that is in use.
+            if isKnownUniquelyReferenced(&node) {
+                return node
+            }
+        }
+        return nil
+    }
+
+    /// The current thread's free list of nodes of this type.
+    ///
+    /// Combinators such as `joinAll` and `mergeAll` create a scheduler, and a
+    /// node for each of their futures, for every request they handle. Nodes
+    /// are returned to the free list of the thread the scheduler is destroyed
+    /// on, in bulk, and reused by the next schedulers created on that thread,
+    /// so that short-lived schedulers allocate no nodes in the steady state.
+    private static var _freeList: FreeList {
+        return ThreadRuntime.cache(FreeList.self) { FreeList() }
+    }
+
+    private final class FreeList {
+        var nodes = [Node]()
+    }
+
     func enqueue(_ head: Node, _ tail: Node) {
         head.next.store(nil, order: .relaxed)
         guard let prev = AtomicNode.exchange(&_head, head, order: .acqrel) else {
@@ -318,3 +391,6 @@ private final class _ReadyQueue<F: FutureProtocol> {
         }
     }
 }
+
+/// The maximum number of nodes kept on each free list.
+private let _NODE_FREE_LIST_CAPACITY = 1_024
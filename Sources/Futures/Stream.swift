@@ -89,10 +89,20 @@ extension Stream {
 /// You can also use `AnyStream` to create a custom stream by providing a
 /// closure for the `pollNext` method, rather than implementing `StreamProtocol`
 /// directly on a custom type.
+///
+/// Streams of up to three words in size are stored inline; erasing them
+/// does not allocate. Like the streams it wraps, `AnyStream` has value
+/// semantics; polling a copy does not affect the original.
+///
+/// - Important: This is a breaking change. Copies of `AnyStream` used to share
+///     the wrapped stream, so polling one copy advanced all of them. Code
+///     that relied on this must now share a single instance instead, e.g.
+///     by storing it in a class. Streams created from a closure
+///     still share whatever state the closure captures.
 public struct AnyStream<Output>: StreamProtocol {
     public typealias PollNextFn = (inout Context) -> Poll<Output?>
 
-    @usableFromInline let _pollNextFn: PollNextFn
+    @usableFromInline var _storage: _AnyStreamStorage
 
     /// Creates a type-erasing stream implemented by the provided closure.
     ///
@@ -107,28 +117,25 @@ public struct AnyStream<Output>: StreamProtocol {
     ///
     @inlinable
     public init(_ pollNext: @escaping PollNextFn) {
-        _pollNextFn = pollNext
+        _storage = _ErasedPollNextFn(pollNext)
     }
 
     /// Creates a type-erasing stream to wrap the provided stream.
     ///
-    /// This initializer performs a heap allocation unless the wrapped stream
-    /// is already type-erased.
+    /// This initializer performs a heap allocation if the wrapped stream
+    /// is larger than three words, unless it is already type-erased.
     @inlinable
     public init<S: StreamProtocol>(_ stream: S) where S.Output == Output {
         if let s = stream as? AnyStream {
-            _pollNextFn = s._pollNextFn
+            self = s
         } else {
-            var s = stream
-            _pollNextFn = {
-                s.pollNext(&$0)
-            }
+            _storage = _ErasedStream(stream)
         }
     }
 
     @inlinable
-    public func pollNext(_ context: inout Context) -> Poll<Output?> {
-        return _pollNextFn(&context)
+    public mutating func pollNext(_ context: inout Context) -> Poll<Output?> {
+        return _storage._pollNext(&context)
     }
 }
 
@@ -2142,6 +2149,16 @@ extension StreamProtocol {
     public func print(_ prefix: String = "", to stream: TextOutputStream? = nil) -> Stream._Private.Print<Self> {
         return .init(base: self, prefix: prefix, to: stream)
     }
+
+    /// Records throughput and latency statistics for this stage of a
+    /// pipeline into the profile registered with `StreamProfiler` for
+    /// `label`.
+    ///
+    /// - Returns: `some StreamProtocol<Output == Self.Output>`
+    @inlinable
+    public func instrument(label: String) -> Stream._Private.Instrument<Self> {
+        return .init(base: self, profile: StreamProfiler.profile(for: label))
+    }
 }
 
 // MARK: - Private -
@@ -30,6 +30,9 @@ extension Stream._Private.Buffer: StreamProtocol {
     public mutating func pollNext(_ context: inout Context) -> Poll<Output?> {
         switch _state {
         case .pending(var base, var buffer):
+            // Drop our reference first, so that `buffer` is uniquely
+            // referenced and pushing doesn't copy it.
+            _state = .done
             while true {
                 switch base.pollNext(&context) {
                 case .ready(.some(let output)):
@@ -0,0 +1,51 @@
+//
+//  InstrumentStream.swift
+//  Futures
+//
+//  Copyright © 2019 Akis Kesoglou. Licensed under the MIT license.
+//
+
+import FuturesSync
+
+extension Stream._Private {
+    public enum Instrument<Base: StreamProtocol> {
+        // the time the stream started waiting for its next element, or 0
+        case pending(Base, StreamProfile, UInt64)
+        case done
+
+        @inlinable
+        public init(base: Base, profile: StreamProfile) {
+            self = .pending(base, profile, 0)
+        }
+    }
+}
+
+extension Stream._Private.Instrument: StreamProtocol {
+    public typealias Output = Base.Output
+
+    @inlinable
+    public mutating func pollNext(_ context: inout Context) -> Poll<Output?> {
+        switch self {
+        case .pending(var base, let profile, let waitingSince):
+            let start = MonotonicClock.cycles.now()
+            let result = base.pollNext(&context)
+            let end = MonotonicClock.cycles.now()
+            let waitingSince = waitingSince == 0 ? start : waitingSince
+            profile._recordPoll(start: start, end: end)
+            switch result {
+            case .ready(.some):
+                self = .pending(base, profile, 0)
+                profile._recordElement(waitingSince: waitingSince, end: end)
+            case .ready(.none):
+                self = .done
+            case .pending:
+                self = .pending(base, profile, waitingSince)
+                profile._recordPending()
+            }
+            return result
+
+        case .done:
+            fatalError("cannot poll after completion")
+        }
+    }
+}
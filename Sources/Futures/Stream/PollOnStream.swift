@@ -27,9 +27,26 @@ extension Stream._Private.PollOn: StreamProtocol {
     public mutating func pollNext(_ context: inout Context) -> Poll<Output?> {
         while true {
             switch self {
-            case .pending(let executor, let base):
-                self = .waiting(executor, base.makeFuture().poll(on: executor))
-                continue
+            case .pending(let executor, var base):
+                guard executor._canRunInline else {
+                    self = .waiting(executor, base.makeFuture().poll(on: executor))
+                    continue
+                }
+                // already running on the executor; poll in place
+                let result = InlineExecution._run {
+                    base.pollNext(&context)
+                }
+                switch result {
+                case .ready(.some(let output)):
+                    self = .pending(executor, base)
+                    return .ready(.success(output))
+                case .ready(.none):
+                    self = .done
+                    return .ready(nil)
+                case .pending:
+                    self = .pending(executor, base)
+                    return .pending
+                }
 
             case .waiting(let executor, var future):
                 switch future.poll(&context) {
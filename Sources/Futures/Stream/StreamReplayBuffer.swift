@@ -38,9 +38,13 @@ extension Stream._Private._ReplayBuffer {
         case .just:
             self = .just(element)
         case .some(var buf):
+            // Drop our reference first, so that `buf` is uniquely referenced
+            // and pushing doesn't copy it.
+            self = .none
             buf.push(element, expand: false)
             self = .some(buf)
         case .all(var elements):
+            self = .none
             elements.append(element)
             self = .all(elements)
         }
@@ -0,0 +1,194 @@
+//
+//  StreamProfiler.swift
+//  Futures
+//
+//  Copyright © 2019 Akis Kesoglou. Licensed under the MIT license.
+//
+
+import FuturesSync
+
+/// The statistics of one or more instrumented streams sharing a label;
+/// see `StreamProtocol.instrument(label:)`.
+public final class StreamProfile {
+    /// A label identifying the streams.
+    public let label: String
+
+    @usableFromInline let _polls = StripedCounter()
+    @usableFromInline let _pendingPolls = StripedCounter()
+    @usableFromInline let _elements = StripedCounter()
+    @usableFromInline var _firstPollTime: AtomicUInt64.RawValue = 0
+    @usableFromInline var _lastElementTime: AtomicUInt64.RawValue = 0
+    @usableFromInline let _latencies = LatencyHistogram(shards: StripedCounter.defaultStripes)
+    @usableFromInline let _pollTimes = LatencyHistogram(shards: StripedCounter.defaultStripes)
+
+    /// Creates a profile that is not registered with `StreamProfiler`.
+    public init(label: String) {
+        self.label = label
+        AtomicUInt64.initialize(&_firstPollTime, to: 0)
+        AtomicUInt64.initialize(&_lastElementTime, to: 0)
+    }
+
+    /// A snapshot of the statistics of a profile.
+    public struct Statistics: Equatable {
+        /// The label of the profile.
+        public var label: String
+
+        /// The number of times the streams were polled.
+        public var polls: Int
+
+        /// The number of polls that returned `.pending`.
+        public var pendingPolls: Int
+
+        /// The number of elements the streams produced.
+        public var elements: Int
+
+        /// The time from the first poll to the last element produced, in
+        /// nanoseconds.
+        public var duration: UInt64
+
+        /// The time from the first poll after an element, or after the first
+        /// poll, until the next element was produced, in nanoseconds. This
+        /// includes time spent waiting while the stream was pending.
+        public var latencies: LatencyHistogram.Snapshot
+
+        /// The time spent inside each poll of the instrumented streams, in
+        /// nanoseconds. This includes time spent in the upstream stages; the
+        /// time spent in a stage itself is the difference from the poll
+        /// times of the stage before it.
+        public var pollTimes: LatencyHistogram.Snapshot
+
+        /// The ratio of polls that returned `.pending`.
+        public var pendingRatio: Double {
+            polls == 0 ? 0 : Double(pendingPolls) / Double(polls)
+        }
+
+        /// The number of elements produced per second, over `duration`.
+        public var elementsPerSecond: Double {
+            duration == 0 ? 0 : Double(elements) * 1e9 / Double(duration)
+        }
+    }
+
+    /// The statistics gathered since the profile was created or last reset.
+    public var statistics: Statistics {
+        let start = AtomicUInt64.load(&_firstPollTime, order: .relaxed)
+        let end = AtomicUInt64.load(&_lastElementTime, order: .relaxed)
+        return Statistics(
+            label: label,
+            polls: _polls.sum,
+            pendingPolls: _pendingPolls.sum,
+            elements: _elements.sum,
+            duration: end > start ? end - start : 0,
+            latencies: _latencies.snapshot,
+            pollTimes: _pollTimes.snapshot
+        )
+    }
+
+    /// Resets statistics and returns their previous values.
+    @discardableResult
+    public func resetStatistics() -> Statistics {
+        let start = AtomicUInt64.exchange(&_firstPollTime, 0, order: .relaxed)
+        let end = AtomicUInt64.exchange(&_lastElementTime, 0, order: .relaxed)
+        return Statistics(
+            label: label,
+            polls: _polls.reset(),
+            pendingPolls: _pendingPolls.reset(),
+            elements: _elements.reset(),
+            duration: end > start ? end - start : 0,
+            latencies: _latencies.reset(),
+            pollTimes: _pollTimes.reset()
+        )
+    }
+
+    @usableFromInline
+    func _recordPoll(start: UInt64, end: UInt64) {
+        if AtomicUInt64.load(&_firstPollTime, order: .relaxed) == 0 {
+            AtomicUInt64.compareExchange(&_firstPollTime, 0, start, order: .relaxed)
+        }
+        _polls.increment()
+        _pollTimes.record(end &- start)
+    }
+
+    @usableFromInline
+    func _recordElement(waitingSince: UInt64, end: UInt64) {
+        _elements.increment()
+        AtomicUInt64.store(&_lastElementTime, end, order: .relaxed)
+        _latencies.record(end &- waitingSince)
+    }
+
+    @usableFromInline
+    func _recordPending() {
+        _pendingPolls.increment()
+    }
+}
+
+extension StreamProfile.Statistics: CustomStringConvertible {
+    public var description: String {
+        let rate = (elementsPerSecond * 100).rounded() / 100
+        let pending = (pendingRatio * 10_000).rounded() / 100
+        return "\(label): \(elements) elements (\(rate)/s), \(polls) polls, \(pending)% pending; " +
+            "latency p50 <= \(latencies.percentile(50))ns, p99 <= \(latencies.percentile(99))ns; " +
+            "poll p50 <= \(pollTimes.percentile(50))ns, p99 <= \(pollTimes.percentile(99))ns"
+    }
+}
+
+/// The process-wide registry of stream profiles.
+///
+/// Label the stages of a pipeline with a common prefix to dump them
+/// together, in the order they were registered; upstream stages are
+/// typically created, and therefore registered, first.
+///
+///     let s = source
+///         .instrument(label: "ingest.source")
+///         .map(decode)
+///         .instrument(label: "ingest.decode")
+///     ...
+///     print(StreamProfiler.report(prefix: "ingest."))
+public enum StreamProfiler {
+    /// Returns the profile registered for `label`, registering a new one if
+    /// there is none.
+    public static func profile(for label: String) -> StreamProfile {
+        return _registry.withMutableValue { registry in
+            if let profile = registry.profiles[label] {
+                return profile
+            }
+            let profile = StreamProfile(label: label)
+            registry.profiles[label] = profile
+            registry.order.append(profile)
+            return profile
+        }
+    }
+
+    /// The statistics of the registered profiles whose label starts with
+    /// `prefix`, in registration order.
+    public static func statistics(prefix: String = "") -> [StreamProfile.Statistics] {
+        return _profiles(prefix: prefix).map { $0.statistics }
+    }
+
+    /// Resets the statistics of the registered profiles whose label starts
+    /// with `prefix` and returns their previous values, in registration
+    /// order.
+    @discardableResult
+    public static func resetStatistics(prefix: String = "") -> [StreamProfile.Statistics] {
+        return _profiles(prefix: prefix).map { $0.resetStatistics() }
+    }
+
+    /// Returns a human-readable report of the statistics of the registered
+    /// profiles whose label starts with `prefix`, one line per profile, in
+    /// registration order.
+    public static func report(prefix: String = "") -> String {
+        return statistics(prefix: prefix).map { $0.description }.joined(separator: "\n")
+    }
+
+    private static func _profiles(prefix: String) -> [StreamProfile] {
+        return _registry.withMutableValue { registry in
+            registry.order.filter { $0.label.hasPrefix(prefix) }
+        }
+    }
+}
+
+private struct _Registry {
+    var profiles = [String: StreamProfile]()
+    var order = [StreamProfile]()
+}
+
+private let _registry = Mutex(_Registry(), lock: PosixLock())
@@ -0,0 +1,172 @@
+//
+//  AllocationCounter.c
+//  Futures
+//
+//  Copyright © 2019 Akis Kesoglou. All rights reserved.
+//
+
+#include "FuturesAllocationCounter.h"
+
+#include <stddef.h>
+
+#if !defined(__has_feature)
+#define __has_feature(x) 0
+#endif
+
+#if __has_feature(address_sanitizer) || __has_feature(thread_sanitizer) || \
+    defined(__SANITIZE_ADDRESS__) || defined(__SANITIZE_THREAD__)
+#define _COUNTER_AVAILABLE 0
+#elif defined(__APPLE__) || defined(__GLIBC__)
+#define _COUNTER_AVAILABLE 1
+#else
+#define _COUNTER_AVAILABLE 0
+#endif
+
+// The counters are thread-local, so that allocations made by other threads,
+// such as concurrently running tests, are not counted. The allocator may be
+// entered before the thread's dynamic TLS is set up; the initial-exec model
+// avoids calling into the dynamic loader, which itself allocates.
+#define _COUNTER_TLS _Thread_local __attribute__((tls_model("initial-exec")))
+
+static _COUNTER_TLS bool _enabled;
+static _COUNTER_TLS FuturesAllocationCounts _counts;
+
+#if _COUNTER_AVAILABLE
+
+static inline void _countAllocation(void) {
+    if (_enabled) {
+        _counts.allocations += 1;
+    }
+}
+
+static inline void _countDeallocation(void) {
+    if (_enabled) {
+        _counts.deallocations += 1;
+    }
+}
+
+#endif
+
+// MARK: - Darwin -
+
+#if _COUNTER_AVAILABLE && defined(__APPLE__)
+
+#include <pthread.h>
+
+// The hook used by malloc stack logging; every zone calls it on allocation
+// and deallocation. Not declared in any public header, but stable.
+typedef void (_MallocLogger)(uint32_t type, uintptr_t arg1, uintptr_t arg2,
+                             uintptr_t arg3, uintptr_t result,
+                             uint32_t numHotFramesToSkip);
+extern _MallocLogger *malloc_logger;
+
+#define _MALLOC_LOG_TYPE_ALLOCATE 2
+#define _MALLOC_LOG_TYPE_DEALLOCATE 4
+
+static void _logger(uint32_t type, uintptr_t arg1, uintptr_t arg2,
+                    uintptr_t arg3, uintptr_t result,
+                    uint32_t numHotFramesToSkip) {
+    // realloc() is logged as both
+    if (type & _MALLOC_LOG_TYPE_ALLOCATE) {
+        _countAllocation();
+    }
+    if (type & _MALLOC_LOG_TYPE_DEALLOCATE) {
+        _countDeallocation();
+    }
+}
+
+static pthread_once_t _installOnce = PTHREAD_ONCE_INIT;
+
+static void _install(void) {
+    malloc_logger = _logger;
+}
+
+static inline void _installIfNeeded(void) {
+    pthread_once(&_installOnce, _install);
+}
+
+#endif
+
+// MARK: - Linux -
+
+#if _COUNTER_AVAILABLE && defined(__GLIBC__)
+
+// Definitions in the executable take precedence over the ones in libc, for
+// all libraries; forward to glibc's own allocator.
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t count, size_t size);
+extern void *__libc_realloc(void *ptr, size_t size);
+extern void *__libc_memalign(size_t alignment, size_t size);
+extern void __libc_free(void *ptr);
+
+void *malloc(size_t size) {
+    _countAllocation();
+    return __libc_malloc(size);
+}
+
+void *calloc(size_t count, size_t size) {
+    _countAllocation();
+    return __libc_calloc(count, size);
+}
+
+void *realloc(void *ptr, size_t size) {
+    _countAllocation();
+    if (ptr != NULL) {
+        _countDeallocation();
+    }
+    return __libc_realloc(ptr, size);
+}
+
+void *memalign(size_t alignment, size_t size) {
+    _countAllocation();
+    return __libc_memalign(alignment, size);
+}
+
+void *aligned_alloc(size_t alignment, size_t size) {
+    _countAllocation();
+    return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void **ptr, size_t alignment, size_t size) {
+    if (alignment < sizeof(void *) || (alignment & (alignment - 1)) != 0) {
+        return 22; // EINVAL
+    }
+    _countAllocation();
+    void *result = __libc_memalign(alignment, size);
+    if (result == NULL) {
+        return 12; // ENOMEM
+    }
+    *ptr = result;
+    return 0;
+}
+
+void free(void *ptr) {
+    if (ptr != NULL) {
+        _countDeallocation();
+    }
+    __libc_free(ptr);
+}
+
+static inline void _installIfNeeded(void) {}
+
+#endif
+
+// MARK: - API -
+
+bool FuturesAllocationCounterIsAvailable(void) {
+    return _COUNTER_AVAILABLE;
+}
+
+void FuturesAllocationCounterStart(void) {
+#if _COUNTER_AVAILABLE
+    _installIfNeeded();
+#endif
+    _counts.allocations = 0;
+    _counts.deallocations = 0;
+    _enabled = true;
+}
+
+FuturesAllocationCounts FuturesAllocationCounterStop(void) {
+    _enabled = false;
+    return _counts;
+}
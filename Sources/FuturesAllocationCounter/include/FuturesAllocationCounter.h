@@ -0,0 +1,34 @@
+//
+//  FuturesAllocationCounter.h
+//  Futures
+//
+//  Copyright © 2019 Akis Kesoglou. All rights reserved.
+//
+
+#ifndef FuturesAllocationCounter_h
+#define FuturesAllocationCounter_h
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/// Counts of heap allocations and deallocations made by a thread.
+typedef struct FuturesAllocationCounts {
+    uint64_t allocations;
+    uint64_t deallocations;
+} FuturesAllocationCounts;
+
+/// Returns true if allocations can be counted in this process.
+///
+/// Counting relies on interposing the allocator on Linux (glibc) and on the
+/// malloc logger hook on Darwin, and is not available in builds that use a
+/// sanitizer, which replaces the allocator itself.
+bool FuturesAllocationCounterIsAvailable(void);
+
+/// Starts counting the allocations made by the current thread.
+void FuturesAllocationCounterStart(void);
+
+/// Stops counting the allocations made by the current thread and returns
+/// the counts since the matching call to `FuturesAllocationCounterStart()`.
+FuturesAllocationCounts FuturesAllocationCounterStop(void);
+
+#endif /* FuturesAllocationCounter_h */
@@ -1 +1,38 @@
+//
+//  Private.c
+//  Futures
+//
+//  Copyright © 2019 Akis Kesoglou. All rights reserved.
+//
 
+#if defined(__linux__)
+#define _GNU_SOURCE
+#include <sched.h>
+#endif
+
+#include "FuturesPrivate.h"
+
+#if !CATOMIC_DOUBLEWORD_LOCK_FREE
+atomic_flag _CAtomicDoubleWordLocks[_CATOMIC_DOUBLEWORD_LOCK_COUNT] = { ATOMIC_FLAG_INIT };
+#endif
+
+_Thread_local CThreadRuntime _CThreadRuntimeCurrent = {
+    .executor = NULL,
+    .executorType = 0,
+    .caches = NULL,
+    .epochParticipant = NULL,
+    .threadIndex = -1,
+    .workerIndex = -1,
+    .cpu = -1,
+    .tickTime = 0,
+    .inlineDepth = 0,
+    .backoffFinishes = 0,
+};
+
+int32_t CThreadRuntimeGetCPU(void) {
+#if defined(__linux__)
+    return (int32_t)sched_getcpu();
+#else
+    return -1;
+#endif
+}
@@ -15,6 +15,7 @@
 #include <stdlib.h>
 #include <stdatomic.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <assert.h>
 
 #if __has_attribute(__always_inline__)
@@ -220,7 +221,10 @@ c_type C##name##Load(name##Pointer ptr, enum AtomicLoadMemoryOrder order) { \
 _CATOMIC_INLINE \
 void C##name##Store(name##Pointer ptr, c_type value, enum AtomicStoreMemoryOrder order) { \
     atomic_store_explicit((atomic_type *)ptr, value, order); \
-} \
+}
+
+#define _CATOMIC_LOGICAL(name, swift_type, atomic_type, c_type) \
+_CATOMIC_VAR(name, swift_type, atomic_type, c_type) \
 _CATOMIC_INLINE \
 c_type C##name##FetchAnd(name##Pointer ptr, c_type value, enum AtomicMemoryOrder order) { \
     return atomic_fetch_and_explicit((atomic_type *)ptr, value, order); \
@@ -234,8 +238,28 @@ c_type C##name##FetchXor(name##Pointer ptr, c_type value, enum AtomicMemoryOrder
     return atomic_fetch_xor_explicit((atomic_type *)ptr, value, order); \
 }
 
+// Min and max are implemented as compare-and-exchange loops, since C11
+// offers no such read-modify-write operations. If `value` would not change
+// the stored value, nothing is written and the operation is a plain load.
+#define _CATOMIC_MIN_MAX(name, swift_type, atomic_type, c_type) \
+_CATOMIC_INLINE \
+c_type C##name##FetchMin(name##Pointer ptr, c_type value, enum AtomicMemoryOrder order) { \
+    enum AtomicLoadMemoryOrder fail = AtomicMemoryOrderStrongestLoadOrder(order); \
+    c_type current = atomic_load_explicit((atomic_type *)ptr, fail); \
+    while (value < current && !atomic_compare_exchange_weak_explicit((atomic_type *)ptr, &current, value, order, fail)) {} \
+    return current; \
+} \
+_CATOMIC_INLINE \
+c_type C##name##FetchMax(name##Pointer ptr, c_type value, enum AtomicMemoryOrder order) { \
+    enum AtomicLoadMemoryOrder fail = AtomicMemoryOrderStrongestLoadOrder(order); \
+    c_type current = atomic_load_explicit((atomic_type *)ptr, fail); \
+    while (value > current && !atomic_compare_exchange_weak_explicit((atomic_type *)ptr, &current, value, order, fail)) {} \
+    return current; \
+}
+
 #define _CATOMIC_INTEGER(name, swift_type, atomic_type, c_type) \
-_CATOMIC_VAR(name, swift_type, atomic_type, c_type) \
+_CATOMIC_LOGICAL(name, swift_type, atomic_type, c_type) \
+_CATOMIC_MIN_MAX(name, swift_type, atomic_type, c_type) \
 _CATOMIC_INLINE \
 c_type C##name##FetchAdd(name##Pointer ptr, c_type value, enum AtomicMemoryOrder order) { \
     return atomic_fetch_add_explicit((atomic_type *)ptr, value, order); \
@@ -245,7 +269,28 @@ c_type C##name##FetchSub(name##Pointer ptr, c_type value, enum AtomicMemoryOrder
     return atomic_fetch_sub_explicit((atomic_type *)ptr, value, order); \
 }
 
-_CATOMIC_VAR(AtomicBool, Bool, atomic_bool, _Bool);
+// Floating-point arithmetic is implemented as compare-and-exchange loops,
+// since C11 only defines atomic arithmetic for integers and pointers.
+// Values are compared bitwise, so the loops terminate even with NaNs.
+#define _CATOMIC_FLOAT(name, swift_type, atomic_type, c_type) \
+_CATOMIC_VAR(name, swift_type, atomic_type, c_type) \
+_CATOMIC_MIN_MAX(name, swift_type, atomic_type, c_type) \
+_CATOMIC_INLINE \
+c_type C##name##FetchAdd(name##Pointer ptr, c_type value, enum AtomicMemoryOrder order) { \
+    enum AtomicLoadMemoryOrder fail = AtomicMemoryOrderStrongestLoadOrder(order); \
+    c_type current = atomic_load_explicit((atomic_type *)ptr, memory_order_relaxed); \
+    while (!atomic_compare_exchange_weak_explicit((atomic_type *)ptr, &current, current + value, order, fail)) {} \
+    return current; \
+} \
+_CATOMIC_INLINE \
+c_type C##name##FetchSub(name##Pointer ptr, c_type value, enum AtomicMemoryOrder order) { \
+    enum AtomicLoadMemoryOrder fail = AtomicMemoryOrderStrongestLoadOrder(order); \
+    c_type current = atomic_load_explicit((atomic_type *)ptr, memory_order_relaxed); \
+    while (!atomic_compare_exchange_weak_explicit((atomic_type *)ptr, &current, current - value, order, fail)) {} \
+    return current; \
+}
+
+_CATOMIC_LOGICAL(AtomicBool, Bool, atomic_bool, _Bool);
 _CATOMIC_INTEGER(AtomicInt, Int, atomic_long, long);
 _CATOMIC_INTEGER(AtomicInt8, Int8, atomic_schar, signed char);
 _CATOMIC_INTEGER(AtomicInt16, Int16, atomic_short, short);
@@ -256,5 +301,216 @@ _CATOMIC_INTEGER(AtomicUInt8, UInt8, atomic_uchar, unsigned char);
 _CATOMIC_INTEGER(AtomicUInt16, UInt16, atomic_ushort, unsigned short);
 _CATOMIC_INTEGER(AtomicUInt32, UInt32, atomic_uint, unsigned int);
 _CATOMIC_INTEGER(AtomicUInt64, UInt64, atomic_ullong, unsigned long long);
+_CATOMIC_FLOAT(AtomicFloat, Float, _Atomic(float), float);
+_CATOMIC_FLOAT(AtomicDouble, Double, _Atomic(double), double);
+
+// MARK: - Double-word
+
+/// A pair of machine words that can be operated on atomically as a whole,
+/// e.g. a pointer and a version counter.
+typedef struct __attribute__((aligned(2 * sizeof(uintptr_t)))) {
+    uintptr_t first;
+    uintptr_t second;
+} DoubleWord;
+
+typedef volatile DoubleWord CAtomicDoubleWord;
+typedef volatile DoubleWord *_Nonnull AtomicDoubleWordPointer;
+
+#define _CATOMIC_DOUBLEWORD_ASSERT_ALIGNED(ptr) \
+    assert(((uintptr_t)(ptr) & (sizeof(DoubleWord) - 1)) == 0)
+
+#if defined(__x86_64__)
+
+// `lock cmpxchg16b` is a full barrier, so all memory orders are promoted
+// to sequentially consistent. Loads, stores and exchanges are implemented
+// in terms of compare-and-exchange since x86-64 offers no other way to
+// access 16 bytes atomically.
+#define CATOMIC_DOUBLEWORD_LOCK_FREE 1
+
+_CATOMIC_INLINE
+_Bool _CAtomicDoubleWordCompareExchange(AtomicDoubleWordPointer ptr, DoubleWord *_Nonnull expected, DoubleWord desired, _Bool weak, enum AtomicMemoryOrder succ, enum AtomicLoadMemoryOrder fail) {
+    _Bool result;
+    _CATOMIC_DOUBLEWORD_ASSERT_ALIGNED(ptr);
+    __asm__ __volatile__(
+        "lock; cmpxchg16b %1\n\t"
+        "sete %0"
+        : "=q"(result), "+m"(*ptr), "+a"(expected->first), "+d"(expected->second)
+        : "b"(desired.first), "c"(desired.second)
+        : "cc", "memory"
+    );
+    return result;
+}
+
+_CATOMIC_INLINE
+DoubleWord _CAtomicDoubleWordLoad(AtomicDoubleWordPointer ptr, enum AtomicLoadMemoryOrder order) {
+    // If the comparison succeeds, the same value is written back.
+    DoubleWord current = {0, 0};
+    _CAtomicDoubleWordCompareExchange(ptr, &current, current, 0, AtomicMemoryOrderSeqcst, AtomicLoadMemoryOrderSeqcst);
+    return current;
+}
+
+_CATOMIC_INLINE
+DoubleWord _CAtomicDoubleWordExchange(AtomicDoubleWordPointer ptr, DoubleWord value, enum AtomicMemoryOrder order) {
+    DoubleWord current = { ptr->first, ptr->second };
+    while (!_CAtomicDoubleWordCompareExchange(ptr, &current, value, 0, AtomicMemoryOrderSeqcst, AtomicLoadMemoryOrderSeqcst)) {}
+    return current;
+}
+
+_CATOMIC_INLINE
+void _CAtomicDoubleWordStore(AtomicDoubleWordPointer ptr, DoubleWord value, enum AtomicStoreMemoryOrder order) {
+    _CAtomicDoubleWordExchange(ptr, value, AtomicMemoryOrderSeqcst);
+}
+
+#elif ((defined(__aarch64__) || defined(__arm64__)) && defined(__clang__)) || __SIZEOF_POINTER__ == 4
+
+// On AArch64, clang lowers 128-bit atomics to `casp` when LSE is available
+// and to `ldaxp`/`stlxp` loops otherwise. On 32-bit platforms a double word
+// fits in a 64-bit integer, which is natively supported.
+#define CATOMIC_DOUBLEWORD_LOCK_FREE 1
+
+#if __SIZEOF_POINTER__ == 4
+typedef uint64_t _CAtomicDoubleWordInt;
+#else
+typedef unsigned __int128 _CAtomicDoubleWordInt;
+#endif
+
+_CATOMIC_INLINE
+_CAtomicDoubleWordInt _CAtomicDoubleWordToInt(DoubleWord value) {
+    _CAtomicDoubleWordInt result;
+    __builtin_memcpy(&result, &value, sizeof(result));
+    return result;
+}
+
+_CATOMIC_INLINE
+DoubleWord _CAtomicDoubleWordFromInt(_CAtomicDoubleWordInt value) {
+    DoubleWord result;
+    __builtin_memcpy(&result, &value, sizeof(result));
+    return result;
+}
+
+_CATOMIC_INLINE
+_Bool _CAtomicDoubleWordCompareExchange(AtomicDoubleWordPointer ptr, DoubleWord *_Nonnull expected, DoubleWord desired, _Bool weak, enum AtomicMemoryOrder succ, enum AtomicLoadMemoryOrder fail) {
+    _CATOMIC_DOUBLEWORD_ASSERT_ALIGNED(ptr);
+    _CAtomicDoubleWordInt current = _CAtomicDoubleWordToInt(*expected);
+    _Bool result = __atomic_compare_exchange_n((volatile _CAtomicDoubleWordInt *)ptr, &current, _CAtomicDoubleWordToInt(desired), weak, succ, fail);
+    *expected = _CAtomicDoubleWordFromInt(current);
+    return result;
+}
+
+_CATOMIC_INLINE
+DoubleWord _CAtomicDoubleWordLoad(AtomicDoubleWordPointer ptr, enum AtomicLoadMemoryOrder order) {
+    return _CAtomicDoubleWordFromInt(__atomic_load_n((volatile _CAtomicDoubleWordInt *)ptr, order));
+}
+
+_CATOMIC_INLINE
+DoubleWord _CAtomicDoubleWordExchange(AtomicDoubleWordPointer ptr, DoubleWord value, enum AtomicMemoryOrder order) {
+    return _CAtomicDoubleWordFromInt(__atomic_exchange_n((volatile _CAtomicDoubleWordInt *)ptr, _CAtomicDoubleWordToInt(value), order));
+}
+
+_CATOMIC_INLINE
+void _CAtomicDoubleWordStore(AtomicDoubleWordPointer ptr, DoubleWord value, enum AtomicStoreMemoryOrder order) {
+    __atomic_store_n((volatile _CAtomicDoubleWordInt *)ptr, _CAtomicDoubleWordToInt(value), order);
+}
+
+#else
+
+// Fall back to a global table of spinlocks, striped by address; see Private.c.
+#define CATOMIC_DOUBLEWORD_LOCK_FREE 0
+#define _CATOMIC_DOUBLEWORD_LOCK_COUNT 64
+
+extern atomic_flag _CAtomicDoubleWordLocks[_CATOMIC_DOUBLEWORD_LOCK_COUNT];
+
+_CATOMIC_INLINE
+atomic_flag *_Nonnull _CAtomicDoubleWordLock(AtomicDoubleWordPointer ptr) {
+    atomic_flag *lock = &_CAtomicDoubleWordLocks[((uintptr_t)ptr / sizeof(DoubleWord)) % _CATOMIC_DOUBLEWORD_LOCK_COUNT];
+    while (atomic_flag_test_and_set_explicit(lock, memory_order_acquire)) {
+        CAtomicHardwarePause();
+    }
+    return lock;
+}
+
+_CATOMIC_INLINE
+void _CAtomicDoubleWordUnlock(atomic_flag *_Nonnull lock) {
+    atomic_flag_clear_explicit(lock, memory_order_release);
+}
+
+_CATOMIC_INLINE
+_Bool _CAtomicDoubleWordCompareExchange(AtomicDoubleWordPointer ptr, DoubleWord *_Nonnull expected, DoubleWord desired, _Bool weak, enum AtomicMemoryOrder succ, enum AtomicLoadMemoryOrder fail) {
+    atomic_flag *lock = _CAtomicDoubleWordLock(ptr);
+    DoubleWord current = { ptr->first, ptr->second };
+    _Bool result = current.first == expected->first && current.second == expected->second;
+    if (result) {
+        ptr->first = desired.first;
+        ptr->second = desired.second;
+    } else {
+        *expected = current;
+    }
+    _CAtomicDoubleWordUnlock(lock);
+    return result;
+}
+
+_CATOMIC_INLINE
+DoubleWord _CAtomicDoubleWordLoad(AtomicDoubleWordPointer ptr, enum AtomicLoadMemoryOrder order) {
+    atomic_flag *lock = _CAtomicDoubleWordLock(ptr);
+    DoubleWord current = { ptr->first, ptr->second };
+    _CAtomicDoubleWordUnlock(lock);
+    return current;
+}
+
+_CATOMIC_INLINE
+DoubleWord _CAtomicDoubleWordExchange(AtomicDoubleWordPointer ptr, DoubleWord value, enum AtomicMemoryOrder order) {
+    atomic_flag *lock = _CAtomicDoubleWordLock(ptr);
+    DoubleWord current = { ptr->first, ptr->second };
+    ptr->first = value.first;
+    ptr->second = value.second;
+    _CAtomicDoubleWordUnlock(lock);
+    return current;
+}
+
+_CATOMIC_INLINE
+void _CAtomicDoubleWordStore(AtomicDoubleWordPointer ptr, DoubleWord value, enum AtomicStoreMemoryOrder order) {
+    _CAtomicDoubleWordExchange(ptr, value, AtomicMemoryOrderSeqcst);
+}
+
+#endif
+
+_CATOMIC_INLINE
+_Bool CAtomicDoubleWordIsLockFree(void) {
+    return CATOMIC_DOUBLEWORD_LOCK_FREE;
+}
+
+_CATOMIC_INLINE
+void CAtomicDoubleWordInitialize(AtomicDoubleWordPointer ptr, DoubleWord value) {
+    _CATOMIC_DOUBLEWORD_ASSERT_ALIGNED(ptr);
+    ptr->first = value.first;
+    ptr->second = value.second;
+}
+
+_CATOMIC_INLINE
+_Bool CAtomicDoubleWordCompareExchangeStrong(AtomicDoubleWordPointer ptr, DoubleWord *_Nonnull expected, DoubleWord desired, enum AtomicMemoryOrder succ, enum AtomicLoadMemoryOrder fail) {
+    assert(((enum AtomicMemoryOrder)fail) <= succ);
+    return _CAtomicDoubleWordCompareExchange(ptr, expected, desired, 0, succ, fail);
+}
+
+_CATOMIC_INLINE
+_Bool CAtomicDoubleWordCompareExchangeWeak(AtomicDoubleWordPointer ptr, DoubleWord *_Nonnull expected, DoubleWord desired, enum AtomicMemoryOrder succ, enum AtomicLoadMemoryOrder fail) {
+    assert(((enum AtomicMemoryOrder)fail) <= succ);
+    return _CAtomicDoubleWordCompareExchange(ptr, expected, desired, 1, succ, fail);
+}
+
+_CATOMIC_INLINE
+DoubleWord CAtomicDoubleWordExchange(AtomicDoubleWordPointer ptr, DoubleWord value, enum AtomicMemoryOrder order) {
+    return _CAtomicDoubleWordExchange(ptr, value, order);
+}
+
+_CATOMIC_INLINE
+DoubleWord CAtomicDoubleWordLoad(AtomicDoubleWordPointer ptr, enum AtomicLoadMemoryOrder order) {
+    return _CAtomicDoubleWordLoad(ptr, order);
+}
+
+_CATOMIC_INLINE
+void CAtomicDoubleWordStore(AtomicDoubleWordPointer ptr, DoubleWord value, enum AtomicStoreMemoryOrder order) {
+    _CAtomicDoubleWordStore(ptr, value, order);
+}
 
 #endif /* CAtomic_h */
@@ -0,0 +1,106 @@
+//
+//  CClock.h
+//  Futures
+//
+//  Copyright © 2019 Akis Kesoglou. All rights reserved.
+//
+
+#ifndef CClock_h
+#define CClock_h
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+
+#if __has_attribute(__always_inline__)
+#define _CCLOCK_INLINE static inline __attribute__((__always_inline__))
+#else
+#define _CCLOCK_INLINE static inline
+#endif
+
+// On Darwin, CLOCK_MONOTONIC keeps counting while the system sleeps and is
+// comparatively slow; the uptime clocks are what `mach_absolute_time()` uses.
+#if defined(__APPLE__)
+#define _CCLOCK_MONOTONIC CLOCK_UPTIME_RAW
+#define _CCLOCK_MONOTONIC_COARSE CLOCK_UPTIME_RAW_APPROX
+#elif defined(CLOCK_MONOTONIC_COARSE)
+#define _CCLOCK_MONOTONIC CLOCK_MONOTONIC
+#define _CCLOCK_MONOTONIC_COARSE CLOCK_MONOTONIC_COARSE
+#else
+#define _CCLOCK_MONOTONIC CLOCK_MONOTONIC
+#define _CCLOCK_MONOTONIC_COARSE CLOCK_MONOTONIC
+#endif
+
+#if defined(__x86_64__) || defined(__i386__) || defined(__aarch64__)
+#define _CCLOCK_HAS_CYCLE_COUNTER 1
+#else
+#define _CCLOCK_HAS_CYCLE_COUNTER 0
+#endif
+
+_CCLOCK_INLINE
+uint64_t _CClockRead(clockid_t clock) {
+    struct timespec ts;
+    clock_gettime(clock, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + (uint64_t)ts.tv_nsec;
+}
+
+/// Returns the value of the monotonic clock, in nanoseconds since an
+/// arbitrary point in the past.
+_CCLOCK_INLINE
+uint64_t CClockMonotonic(void) {
+    return _CClockRead(_CCLOCK_MONOTONIC);
+}
+
+/// Returns the value of the coarse monotonic clock, in nanoseconds since
+/// the same point as `CClockMonotonic()`. The coarse clock is cheaper to read
+/// but is only updated every few milliseconds, depending on the platform.
+_CCLOCK_INLINE
+uint64_t CClockMonotonicCoarse(void) {
+    return _CClockRead(_CCLOCK_MONOTONIC_COARSE);
+}
+
+/// Returns the resolution of the coarse monotonic clock, in nanoseconds.
+_CCLOCK_INLINE
+uint64_t CClockMonotonicCoarseResolution(void) {
+    struct timespec ts;
+    clock_getres(_CCLOCK_MONOTONIC_COARSE, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + (uint64_t)ts.tv_nsec;
+}
+
+/// Returns true if the processor has a cycle counter that
+/// `CClockCycles()` can read.
+_CCLOCK_INLINE
+bool CClockHasCycleCounter(void) {
+    return _CCLOCK_HAS_CYCLE_COUNTER;
+}
+
+/// Returns the value of the processor's cycle counter; the time stamp
+/// counter on x86 and the virtual counter on ARM64. On other processors,
+/// returns the value of `CClockMonotonic()`.
+_CCLOCK_INLINE
+uint64_t CClockCycles(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    return __builtin_ia32_rdtsc();
+#elif defined(__aarch64__)
+    uint64_t value;
+    __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(value));
+    return value;
+#else
+    return CClockMonotonic();
+#endif
+}
+
+/// Returns the frequency of the cycle counter, in Hz, if the processor
+/// reports it, or 0 if it must be measured.
+_CCLOCK_INLINE
+uint64_t CClockCycleFrequency(void) {
+#if defined(__aarch64__)
+    uint64_t value;
+    __asm__ __volatile__("mrs %0, cntfrq_el0" : "=r"(value));
+    return value;
+#else
+    return 0;
+#endif
+}
+
+#endif /* CClock_h */
@@ -0,0 +1,80 @@
+//
+//  CThreadRuntime.h
+//  Futures
+//
+//  Copyright © 2019 Akis Kesoglou. All rights reserved.
+//
+
+#ifndef CThreadRuntime_h
+#define CThreadRuntime_h
+
+#include <stdint.h>
+
+#if __has_attribute(__always_inline__)
+#define _CTHREAD_RUNTIME_INLINE static inline __attribute__((__always_inline__))
+#else
+#define _CTHREAD_RUNTIME_INLINE static inline
+#endif
+
+/// Per-thread runtime state, kept in native (compiler-provided) thread-local
+/// storage so that it can be reached with a single TLS access, instead of a
+/// `pthread_getspecific()` call.
+///
+/// Native TLS cannot run destructors, so the struct only holds unretained
+/// references; whoever stores an object here must keep it alive and clear
+/// the field before releasing it.
+typedef struct CThreadRuntime {
+    /// The current thread's executor, unretained; NULL until first used.
+    void *_Nullable executor;
+
+    /// Identifies the type of `executor`, so that it is never read back as
+    /// another type; 0 until first used.
+    uintptr_t executorType;
+
+    /// The current thread's per-thread caches, unretained; NULL until
+    /// first used.
+    void *_Nullable caches;
+
+    /// The current thread's epoch participant, unretained; NULL until the
+    /// thread first pins itself.
+    void *_Nullable epochParticipant;
+
+    /// A small integer that identifies the thread, or -1 if not yet
+    /// assigned.
+    intptr_t threadIndex;
+
+    /// The index of the thread in the pool that owns it, or -1 if the thread
+    /// is not a pool worker.
+    intptr_t workerIndex;
+
+    /// The processor the thread was last observed to run on, or -1 if not
+    /// known.
+    int32_t cpu;
+
+    /// The monotonic time at which the thread's executor started its current
+    /// tick, in nanoseconds, or 0 if never refreshed.
+    uint64_t tickTime;
+
+    /// The number of nested futures currently being run inline, instead of
+    /// being submitted to the executor that is already running them.
+    intptr_t inlineDepth;
+
+    /// The number of adaptive backoff loops the thread has finished, used
+    /// to sample which of them adapt their site's spin limit.
+    uint32_t backoffFinishes;
+} CThreadRuntime;
+
+extern _Thread_local CThreadRuntime _CThreadRuntimeCurrent;
+
+/// Returns the runtime state of the current thread. The pointer is only
+/// valid on the current thread and must not be shared with other threads.
+_CTHREAD_RUNTIME_INLINE
+CThreadRuntime *_Nonnull CThreadRuntimeGetCurrent(void) {
+    return &_CThreadRuntimeCurrent;
+}
+
+/// Returns the processor the current thread is running on, or -1 if the
+/// platform cannot tell. The result may be stale as soon as it is returned.
+int32_t CThreadRuntimeGetCPU(void);
+
+#endif /* CThreadRuntime_h */
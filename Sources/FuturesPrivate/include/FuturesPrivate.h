@@ -9,5 +9,7 @@
 #define FuturesPrivate_h
 
 #include "CAtomic.h"
+#include "CClock.h"
+#include "CThreadRuntime.h"
 
 #endif /* FuturesPrivate_h */
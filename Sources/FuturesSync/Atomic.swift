@@ -10,6 +10,7 @@ import FuturesPrivate
 @_exported import enum FuturesPrivate.AtomicLoadMemoryOrder
 @_exported import enum FuturesPrivate.AtomicMemoryOrder
 @_exported import enum FuturesPrivate.AtomicStoreMemoryOrder
+@_exported import struct FuturesPrivate.DoubleWord
 
 public enum Atomic {}
 
@@ -53,6 +54,25 @@ extension Atomic {
     }
 }
 
+// MARK: - DoubleWord -
+
+extension DoubleWord: Equatable {
+    @_transparent
+    public static func == (lhs: DoubleWord, rhs: DoubleWord) -> Bool {
+        return lhs.first == rhs.first && lhs.second == rhs.second
+    }
+}
+
+extension AtomicDoubleWord {
+    /// Whether operations on double words are lock-free on the current
+    /// platform. When they are not, they are serialized through a global
+    /// table of spinlocks.
+    @_transparent
+    public static var isLockFree: Bool {
+        return CAtomicDoubleWordIsLockFree()
+    }
+}
+
 // MARK: - Private -
 
 public protocol _CAtomicValue {
@@ -521,6 +521,40 @@ extension AtomicIntPointer {
     public func fetchSub(_ value: Pointee, order: AtomicMemoryOrder = .seqcst) -> Pointee {
         return CAtomicIntFetchSub(self, value, order)
     }
+
+    /// Atomically replaces the value pointed by the receiver with the minimum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already less than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMin(_ value: Pointee, order: AtomicMemoryOrder = .seqcst) -> Pointee {
+        return CAtomicIntFetchMin(self, value, order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the maximum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already greater than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMax(_ value: Pointee, order: AtomicMemoryOrder = .seqcst) -> Pointee {
+        return CAtomicIntFetchMax(self, value, order)
+    }
 }
 
 // MARK: - Int8 -
@@ -800,6 +834,40 @@ extension AtomicInt8Pointer {
     public func fetchSub(_ value: Pointee, order: AtomicMemoryOrder = .seqcst) -> Pointee {
         return CAtomicInt8FetchSub(self, value, order)
     }
+
+    /// Atomically replaces the value pointed by the receiver with the minimum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already less than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMin(_ value: Pointee, order: AtomicMemoryOrder = .seqcst) -> Pointee {
+        return CAtomicInt8FetchMin(self, value, order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the maximum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already greater than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMax(_ value: Pointee, order: AtomicMemoryOrder = .seqcst) -> Pointee {
+        return CAtomicInt8FetchMax(self, value, order)
+    }
 }
 
 // MARK: - Int16 -
@@ -1079,6 +1147,40 @@ extension AtomicInt16Pointer {
     public func fetchSub(_ value: Pointee, order: AtomicMemoryOrder = .seqcst) -> Pointee {
         return CAtomicInt16FetchSub(self, value, order)
     }
+
+    /// Atomically replaces the value pointed by the receiver with the minimum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already less than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMin(_ value: Pointee, order: AtomicMemoryOrder = .seqcst) -> Pointee {
+        return CAtomicInt16FetchMin(self, value, order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the maximum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already greater than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMax(_ value: Pointee, order: AtomicMemoryOrder = .seqcst) -> Pointee {
+        return CAtomicInt16FetchMax(self, value, order)
+    }
 }
 
 // MARK: - Int32 -
@@ -1358,6 +1460,40 @@ extension AtomicInt32Pointer {
     public func fetchSub(_ value: Pointee, order: AtomicMemoryOrder = .seqcst) -> Pointee {
         return CAtomicInt32FetchSub(self, value, order)
     }
+
+    /// Atomically replaces the value pointed by the receiver with the minimum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already less than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMin(_ value: Pointee, order: AtomicMemoryOrder = .seqcst) -> Pointee {
+        return CAtomicInt32FetchMin(self, value, order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the maximum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already greater than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMax(_ value: Pointee, order: AtomicMemoryOrder = .seqcst) -> Pointee {
+        return CAtomicInt32FetchMax(self, value, order)
+    }
 }
 
 // MARK: - Int64 -
@@ -1637,6 +1773,40 @@ extension AtomicInt64Pointer {
     public func fetchSub(_ value: Pointee, order: AtomicMemoryOrder = .seqcst) -> Pointee {
         return CAtomicInt64FetchSub(self, value, order)
     }
+
+    /// Atomically replaces the value pointed by the receiver with the minimum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already less than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMin(_ value: Pointee, order: AtomicMemoryOrder = .seqcst) -> Pointee {
+        return CAtomicInt64FetchMin(self, value, order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the maximum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already greater than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMax(_ value: Pointee, order: AtomicMemoryOrder = .seqcst) -> Pointee {
+        return CAtomicInt64FetchMax(self, value, order)
+    }
 }
 
 // MARK: - UInt -
@@ -1916,6 +2086,40 @@ extension AtomicUIntPointer {
     public func fetchSub(_ value: Pointee, order: AtomicMemoryOrder = .seqcst) -> Pointee {
         return CAtomicUIntFetchSub(self, value, order)
     }
+
+    /// Atomically replaces the value pointed by the receiver with the minimum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already less than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMin(_ value: Pointee, order: AtomicMemoryOrder = .seqcst) -> Pointee {
+        return CAtomicUIntFetchMin(self, value, order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the maximum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already greater than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMax(_ value: Pointee, order: AtomicMemoryOrder = .seqcst) -> Pointee {
+        return CAtomicUIntFetchMax(self, value, order)
+    }
 }
 
 // MARK: - UInt8 -
@@ -2195,6 +2399,40 @@ extension AtomicUInt8Pointer {
     public func fetchSub(_ value: Pointee, order: AtomicMemoryOrder = .seqcst) -> Pointee {
         return CAtomicUInt8FetchSub(self, value, order)
     }
+
+    /// Atomically replaces the value pointed by the receiver with the minimum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already less than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMin(_ value: Pointee, order: AtomicMemoryOrder = .seqcst) -> Pointee {
+        return CAtomicUInt8FetchMin(self, value, order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the maximum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already greater than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMax(_ value: Pointee, order: AtomicMemoryOrder = .seqcst) -> Pointee {
+        return CAtomicUInt8FetchMax(self, value, order)
+    }
 }
 
 // MARK: - UInt16 -
@@ -2474,6 +2712,40 @@ extension AtomicUInt16Pointer {
     public func fetchSub(_ value: Pointee, order: AtomicMemoryOrder = .seqcst) -> Pointee {
         return CAtomicUInt16FetchSub(self, value, order)
     }
+
+    /// Atomically replaces the value pointed by the receiver with the minimum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already less than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMin(_ value: Pointee, order: AtomicMemoryOrder = .seqcst) -> Pointee {
+        return CAtomicUInt16FetchMin(self, value, order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the maximum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already greater than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMax(_ value: Pointee, order: AtomicMemoryOrder = .seqcst) -> Pointee {
+        return CAtomicUInt16FetchMax(self, value, order)
+    }
 }
 
 // MARK: - UInt32 -
@@ -2753,6 +3025,40 @@ extension AtomicUInt32Pointer {
     public func fetchSub(_ value: Pointee, order: AtomicMemoryOrder = .seqcst) -> Pointee {
         return CAtomicUInt32FetchSub(self, value, order)
     }
+
+    /// Atomically replaces the value pointed by the receiver with the minimum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already less than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMin(_ value: Pointee, order: AtomicMemoryOrder = .seqcst) -> Pointee {
+        return CAtomicUInt32FetchMin(self, value, order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the maximum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already greater than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMax(_ value: Pointee, order: AtomicMemoryOrder = .seqcst) -> Pointee {
+        return CAtomicUInt32FetchMax(self, value, order)
+    }
 }
 
 // MARK: - UInt64 -
@@ -3032,4 +3338,748 @@ extension AtomicUInt64Pointer {
     public func fetchSub(_ value: Pointee, order: AtomicMemoryOrder = .seqcst) -> Pointee {
         return CAtomicUInt64FetchSub(self, value, order)
     }
+
+    /// Atomically replaces the value pointed by the receiver with the minimum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already less than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMin(_ value: Pointee, order: AtomicMemoryOrder = .seqcst) -> Pointee {
+        return CAtomicUInt64FetchMin(self, value, order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the maximum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already greater than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMax(_ value: Pointee, order: AtomicMemoryOrder = .seqcst) -> Pointee {
+        return CAtomicUInt64FetchMax(self, value, order)
+    }
+}
+
+// MARK: - Float -
+
+extension AtomicFloatPointer {
+    @_transparent
+    public func initialize(to initialValue: Pointee) {
+        CAtomicFloatInitialize(self, initialValue)
+    }
+
+    /// Atomically loads and returns the current value of the atomic variable
+    /// pointed to by the receiver. The operation is atomic *read* operation.
+    ///
+    /// - Parameters:
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value stored in the receiver.
+    @_transparent
+    public func load(order: AtomicLoadMemoryOrder = .seqcst) -> Pointee {
+        return CAtomicFloatLoad(self, order)
+    }
+
+    /// Atomically replaces the value of the atomic variable pointed to by the
+    /// receiver with `desired`. The operation is atomic *write* operation.
+    ///
+    /// - Parameters:
+    ///     - desired: The value to replace the receiver with.
+    ///     - order: The memory synchronization ordering for this operation.
+    @_transparent
+    public func store(_ desired: Pointee, order: AtomicStoreMemoryOrder = .seqcst) {
+        CAtomicFloatStore(self, desired, order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with `desired`
+    /// and returns the value the receiver held previously. The operation is
+    /// *read-modify-write* operation.
+    ///
+    /// - Parameters:
+    ///     - desired: The value to replace the receiver with.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    public func exchange(_ desired: Pointee, order: AtomicMemoryOrder = .seqcst) -> Pointee {
+        return CAtomicFloatExchange(self, desired, order)
+    }
+
+    /// Atomically compares the value pointed to by the receiver with the
+    /// value pointed to by `expected`, and if those are equal, replaces the
+    /// former with `desired` (performs *read-modify-write* operation).
+    /// Otherwise, loads the actual value pointed to by the receiver into
+    /// `*expected` (performs *load* operation).
+    ///
+    /// - Parameters:
+    ///     - expected: The value expected to be found in the receiver.
+    ///     - desired: The value to store in the receiver if it is as expected.
+    ///     - order: The memory synchronization ordering for the read-modify-write
+    ///       operation if the comparison succeeds.
+    ///     - loadOrder: The memory synchronization ordering for the load
+    ///       operation if the comparison fails. Cannot specify stronger
+    ///       ordering than `order`.
+    ///
+    /// - Returns: The result of the comparison: `true` if current value was
+    ///     equal to `*expected`, `false` otherwise.
+    @_transparent
+    @discardableResult
+    public func compareExchange(
+        _ expected: UnsafeMutablePointer<Pointee>,
+        _ desired: Pointee,
+        order: AtomicMemoryOrder = .seqcst,
+        loadOrder: AtomicLoadMemoryOrder? = nil
+    ) -> Bool {
+        let loadOrder = loadOrder ?? order.strongestLoadOrder()
+        return CAtomicFloatCompareExchangeStrong(
+            self, expected, desired, order, loadOrder
+        )
+    }
+
+    /// Atomically compares the value pointed to by the receiver with the
+    /// value pointed to by `expected`, and if those are equal, replaces the
+    /// former with `desired` (performs *read-modify-write* operation).
+    /// Otherwise, loads the actual value pointed to by the receiver into
+    /// `*expected` (performs *load* operation).
+    ///
+    /// - Parameters:
+    ///     - expected: The value expected to be found in the receiver.
+    ///     - desired: The value to store in the receiver if it is as expected.
+    ///     - order: The memory synchronization ordering for the read-modify-write
+    ///       operation if the comparison succeeds.
+    ///     - loadOrder: The memory synchronization ordering for the load
+    ///       operation if the comparison fails. Cannot specify stronger
+    ///       ordering than `order`.
+    ///
+    /// - Returns: The value actually stored in the receiver. If exchange
+    ///     succeeded, this will be equal to `expected`.
+    @_transparent
+    @discardableResult
+    public func compareExchange(
+        _ expected: Pointee,
+        _ desired: Pointee,
+        order: AtomicMemoryOrder = .seqcst,
+        loadOrder: AtomicLoadMemoryOrder? = nil
+    ) -> Pointee {
+        var current = expected
+        let loadOrder = loadOrder ?? order.strongestLoadOrder()
+        _ = CAtomicFloatCompareExchangeStrong(
+            self, &current, desired, order, loadOrder
+        )
+        return current
+    }
+
+    /// Atomically compares the value pointed to by the receiver with the
+    /// value pointed to by `expected`, and if those are equal, replaces the
+    /// former with `desired` (performs *read-modify-write* operation).
+    /// Otherwise, loads the actual value pointed to by the receiver into
+    /// `*expected` (performs *load* operation).
+    ///
+    /// This form of compare-and-exchange is allowed to fail spuriously, that
+    /// is, act as if `*current != *expected` even if they are equal. When a
+    /// compare-and-exchange is in a loop, this version will yield better
+    /// performance on some platforms. When a weak compare-and-exchange would
+    /// require a loop and a strong one would not, the strong one is preferable.
+    ///
+    /// - Parameters:
+    ///     - expected: The value expected to be found in the receiver.
+    ///     - desired: The value to store in the receiver if it is as expected.
+    ///     - order: The memory synchronization ordering for the read-modify-write
+    ///       operation if the comparison succeeds.
+    ///     - loadOrder: The memory synchronization ordering for the load
+    ///       operation if the comparison fails. Cannot specify stronger
+    ///       ordering than `order`.
+    ///
+    /// - Returns: The result of the comparison: `true` if current value was
+    ///     equal to `*expected`, `false` otherwise.
+    @_transparent
+    @discardableResult
+    public func compareExchangeWeak(
+        _ expected: UnsafeMutablePointer<Pointee>,
+        _ desired: Pointee,
+        order: AtomicMemoryOrder = .seqcst,
+        loadOrder: AtomicLoadMemoryOrder? = nil
+    ) -> Bool {
+        let loadOrder = loadOrder ?? order.strongestLoadOrder()
+        return CAtomicFloatCompareExchangeWeak(
+            self, expected, desired, order, loadOrder
+        )
+    }
+
+    /// Atomically compares the value pointed to by the receiver with the
+    /// value pointed to by `expected`, and if those are equal, replaces the
+    /// former with `desired` (performs *read-modify-write* operation).
+    /// Otherwise, loads the actual value pointed to by the receiver into
+    /// `*expected` (performs *load* operation).
+    ///
+    /// This form of compare-and-exchange is allowed to fail spuriously, that
+    /// is, act as if `*current != *expected` even if they are equal. When a
+    /// compare-and-exchange is in a loop, this version will yield better
+    /// performance on some platforms. When a weak compare-and-exchange would
+    /// require a loop and a strong one would not, the strong one is preferable.
+    ///
+    /// - Parameters:
+    ///     - expected: The value expected to be found in the receiver.
+    ///     - desired: The value to store in the receiver if it is as expected.
+    ///     - order: The memory synchronization ordering for the read-modify-write
+    ///       operation if the comparison succeeds.
+    ///     - loadOrder: The memory synchronization ordering for the load
+    ///       operation if the comparison fails. Cannot specify stronger
+    ///       ordering than `order`.
+    ///
+    /// - Returns: The value actually stored in the receiver. If exchange
+    ///     succeeded, this will be equal to `expected`.
+    @_transparent
+    @discardableResult
+    public func compareExchangeWeak(
+        _ expected: Pointee,
+        _ desired: Pointee,
+        order: AtomicMemoryOrder = .seqcst,
+        loadOrder: AtomicLoadMemoryOrder? = nil
+    ) -> Pointee {
+        var current = expected
+        let loadOrder = loadOrder ?? order.strongestLoadOrder()
+        _ = CAtomicFloatCompareExchangeWeak(
+            self, &current, desired, order, loadOrder
+        )
+        return current
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the result
+    /// of addition of `value` to the old value of the receiver, and returns
+    /// the value the receiver held previously. The operation is *read-modify-write*
+    /// operation.
+    ///
+    /// For signed integer types, arithmetic is defined to use two’s
+    /// complement representation. There are no undefined results. For pointer
+    /// types, the result may be an undefined address, but the operations
+    /// otherwise have no undefined behavior.
+    ///
+    /// - Parameters:
+    ///     - value: The value to add to the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchAdd(_ value: Pointee, order: AtomicMemoryOrder = .seqcst) -> Pointee {
+        return CAtomicFloatFetchAdd(self, value, order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the result
+    /// of subtraction of `value` to the old value of the receiver, and returns
+    /// the value the receiver held previously. The operation is *read-modify-write*
+    /// operation.
+    ///
+    /// For signed integer types, arithmetic is defined to use two’s complement
+    /// representation. There are no undefined results. For pointer types, the
+    /// result may be an undefined address, but the operations otherwise have
+    /// no undefined behavior.
+    ///
+    /// - Parameters:
+    ///     - value: The value to subtract from the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchSub(_ value: Pointee, order: AtomicMemoryOrder = .seqcst) -> Pointee {
+        return CAtomicFloatFetchSub(self, value, order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the minimum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already less than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMin(_ value: Pointee, order: AtomicMemoryOrder = .seqcst) -> Pointee {
+        return CAtomicFloatFetchMin(self, value, order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the maximum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already greater than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMax(_ value: Pointee, order: AtomicMemoryOrder = .seqcst) -> Pointee {
+        return CAtomicFloatFetchMax(self, value, order)
+    }
+}
+
+// MARK: - Double -
+
+extension AtomicDoublePointer {
+    @_transparent
+    public func initialize(to initialValue: Pointee) {
+        CAtomicDoubleInitialize(self, initialValue)
+    }
+
+    /// Atomically loads and returns the current value of the atomic variable
+    /// pointed to by the receiver. The operation is atomic *read* operation.
+    ///
+    /// - Parameters:
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value stored in the receiver.
+    @_transparent
+    public func load(order: AtomicLoadMemoryOrder = .seqcst) -> Pointee {
+        return CAtomicDoubleLoad(self, order)
+    }
+
+    /// Atomically replaces the value of the atomic variable pointed to by the
+    /// receiver with `desired`. The operation is atomic *write* operation.
+    ///
+    /// - Parameters:
+    ///     - desired: The value to replace the receiver with.
+    ///     - order: The memory synchronization ordering for this operation.
+    @_transparent
+    public func store(_ desired: Pointee, order: AtomicStoreMemoryOrder = .seqcst) {
+        CAtomicDoubleStore(self, desired, order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with `desired`
+    /// and returns the value the receiver held previously. The operation is
+    /// *read-modify-write* operation.
+    ///
+    /// - Parameters:
+    ///     - desired: The value to replace the receiver with.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    public func exchange(_ desired: Pointee, order: AtomicMemoryOrder = .seqcst) -> Pointee {
+        return CAtomicDoubleExchange(self, desired, order)
+    }
+
+    /// Atomically compares the value pointed to by the receiver with the
+    /// value pointed to by `expected`, and if those are equal, replaces the
+    /// former with `desired` (performs *read-modify-write* operation).
+    /// Otherwise, loads the actual value pointed to by the receiver into
+    /// `*expected` (performs *load* operation).
+    ///
+    /// - Parameters:
+    ///     - expected: The value expected to be found in the receiver.
+    ///     - desired: The value to store in the receiver if it is as expected.
+    ///     - order: The memory synchronization ordering for the read-modify-write
+    ///       operation if the comparison succeeds.
+    ///     - loadOrder: The memory synchronization ordering for the load
+    ///       operation if the comparison fails. Cannot specify stronger
+    ///       ordering than `order`.
+    ///
+    /// - Returns: The result of the comparison: `true` if current value was
+    ///     equal to `*expected`, `false` otherwise.
+    @_transparent
+    @discardableResult
+    public func compareExchange(
+        _ expected: UnsafeMutablePointer<Pointee>,
+        _ desired: Pointee,
+        order: AtomicMemoryOrder = .seqcst,
+        loadOrder: AtomicLoadMemoryOrder? = nil
+    ) -> Bool {
+        let loadOrder = loadOrder ?? order.strongestLoadOrder()
+        return CAtomicDoubleCompareExchangeStrong(
+            self, expected, desired, order, loadOrder
+        )
+    }
+
+    /// Atomically compares the value pointed to by the receiver with the
+    /// value pointed to by `expected`, and if those are equal, replaces the
+    /// former with `desired` (performs *read-modify-write* operation).
+    /// Otherwise, loads the actual value pointed to by the receiver into
+    /// `*expected` (performs *load* operation).
+    ///
+    /// - Parameters:
+    ///     - expected: The value expected to be found in the receiver.
+    ///     - desired: The value to store in the receiver if it is as expected.
+    ///     - order: The memory synchronization ordering for the read-modify-write
+    ///       operation if the comparison succeeds.
+    ///     - loadOrder: The memory synchronization ordering for the load
+    ///       operation if the comparison fails. Cannot specify stronger
+    ///       ordering than `order`.
+    ///
+    /// - Returns: The value actually stored in the receiver. If exchange
+    ///     succeeded, this will be equal to `expected`.
+    @_transparent
+    @discardableResult
+    public func compareExchange(
+        _ expected: Pointee,
+        _ desired: Pointee,
+        order: AtomicMemoryOrder = .seqcst,
+        loadOrder: AtomicLoadMemoryOrder? = nil
+    ) -> Pointee {
+        var current = expected
+        let loadOrder = loadOrder ?? order.strongestLoadOrder()
+        _ = CAtomicDoubleCompareExchangeStrong(
+            self, &current, desired, order, loadOrder
+        )
+        return current
+    }
+
+    /// Atomically compares the value pointed to by the receiver with the
+    /// value pointed to by `expected`, and if those are equal, replaces the
+    /// former with `desired` (performs *read-modify-write* operation).
+    /// Otherwise, loads the actual value pointed to by the receiver into
+    /// `*expected` (performs *load* operation).
+    ///
+    /// This form of compare-and-exchange is allowed to fail spuriously, that
+    /// is, act as if `*current != *expected` even if they are equal. When a
+    /// compare-and-exchange is in a loop, this version will yield better
+    /// performance on some platforms. When a weak compare-and-exchange would
+    /// require a loop and a strong one would not, the strong one is preferable.
+    ///
+    /// - Parameters:
+    ///     - expected: The value expected to be found in the receiver.
+    ///     - desired: The value to store in the receiver if it is as expected.
+    ///     - order: The memory synchronization ordering for the read-modify-write
+    ///       operation if the comparison succeeds.
+    ///     - loadOrder: The memory synchronization ordering for the load
+    ///       operation if the comparison fails. Cannot specify stronger
+    ///       ordering than `order`.
+    ///
+    /// - Returns: The result of the comparison: `true` if current value was
+    ///     equal to `*expected`, `false` otherwise.
+    @_transparent
+    @discardableResult
+    public func compareExchangeWeak(
+        _ expected: UnsafeMutablePointer<Pointee>,
+        _ desired: Pointee,
+        order: AtomicMemoryOrder = .seqcst,
+        loadOrder: AtomicLoadMemoryOrder? = nil
+    ) -> Bool {
+        let loadOrder = loadOrder ?? order.strongestLoadOrder()
+        return CAtomicDoubleCompareExchangeWeak(
+            self, expected, desired, order, loadOrder
+        )
+    }
+
+    /// Atomically compares the value pointed to by the receiver with the
+    /// value pointed to by `expected`, and if those are equal, replaces the
+    /// former with `desired` (performs *read-modify-write* operation).
+    /// Otherwise, loads the actual value pointed to by the receiver into
+    /// `*expected` (performs *load* operation).
+    ///
+    /// This form of compare-and-exchange is allowed to fail spuriously, that
+    /// is, act as if `*current != *expected` even if they are equal. When a
+    /// compare-and-exchange is in a loop, this version will yield better
+    /// performance on some platforms. When a weak compare-and-exchange would
+    /// require a loop and a strong one would not, the strong one is preferable.
+    ///
+    /// - Parameters:
+    ///     - expected: The value expected to be found in the receiver.
+    ///     - desired: The value to store in the receiver if it is as expected.
+    ///     - order: The memory synchronization ordering for the read-modify-write
+    ///       operation if the comparison succeeds.
+    ///     - loadOrder: The memory synchronization ordering for the load
+    ///       operation if the comparison fails. Cannot specify stronger
+    ///       ordering than `order`.
+    ///
+    /// - Returns: The value actually stored in the receiver. If exchange
+    ///     succeeded, this will be equal to `expected`.
+    @_transparent
+    @discardableResult
+    public func compareExchangeWeak(
+        _ expected: Pointee,
+        _ desired: Pointee,
+        order: AtomicMemoryOrder = .seqcst,
+        loadOrder: AtomicLoadMemoryOrder? = nil
+    ) -> Pointee {
+        var current = expected
+        let loadOrder = loadOrder ?? order.strongestLoadOrder()
+        _ = CAtomicDoubleCompareExchangeWeak(
+            self, &current, desired, order, loadOrder
+        )
+        return current
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the result
+    /// of addition of `value` to the old value of the receiver, and returns
+    /// the value the receiver held previously. The operation is *read-modify-write*
+    /// operation.
+    ///
+    /// For signed integer types, arithmetic is defined to use two’s
+    /// complement representation. There are no undefined results. For pointer
+    /// types, the result may be an undefined address, but the operations
+    /// otherwise have no undefined behavior.
+    ///
+    /// - Parameters:
+    ///     - value: The value to add to the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchAdd(_ value: Pointee, order: AtomicMemoryOrder = .seqcst) -> Pointee {
+        return CAtomicDoubleFetchAdd(self, value, order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the result
+    /// of subtraction of `value` to the old value of the receiver, and returns
+    /// the value the receiver held previously. The operation is *read-modify-write*
+    /// operation.
+    ///
+    /// For signed integer types, arithmetic is defined to use two’s complement
+    /// representation. There are no undefined results. For pointer types, the
+    /// result may be an undefined address, but the operations otherwise have
+    /// no undefined behavior.
+    ///
+    /// - Parameters:
+    ///     - value: The value to subtract from the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchSub(_ value: Pointee, order: AtomicMemoryOrder = .seqcst) -> Pointee {
+        return CAtomicDoubleFetchSub(self, value, order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the minimum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already less than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMin(_ value: Pointee, order: AtomicMemoryOrder = .seqcst) -> Pointee {
+        return CAtomicDoubleFetchMin(self, value, order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the maximum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already greater than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMax(_ value: Pointee, order: AtomicMemoryOrder = .seqcst) -> Pointee {
+        return CAtomicDoubleFetchMax(self, value, order)
+    }
+}
+
+// MARK: - DoubleWord -
+
+extension AtomicDoubleWordPointer {
+    @_transparent
+    public func initialize(to initialValue: Pointee) {
+        CAtomicDoubleWordInitialize(self, initialValue)
+    }
+
+    /// Atomically loads and returns the current value of the atomic variable
+    /// pointed to by the receiver. The operation is atomic *read* operation.
+    ///
+    /// - Parameters:
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value stored in the receiver.
+    @_transparent
+    public func load(order: AtomicLoadMemoryOrder = .seqcst) -> Pointee {
+        return CAtomicDoubleWordLoad(self, order)
+    }
+
+    /// Atomically replaces the value of the atomic variable pointed to by the
+    /// receiver with `desired`. The operation is atomic *write* operation.
+    ///
+    /// - Parameters:
+    ///     - desired: The value to replace the receiver with.
+    ///     - order: The memory synchronization ordering for this operation.
+    @_transparent
+    public func store(_ desired: Pointee, order: AtomicStoreMemoryOrder = .seqcst) {
+        CAtomicDoubleWordStore(self, desired, order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with `desired`
+    /// and returns the value the receiver held previously. The operation is
+    /// *read-modify-write* operation.
+    ///
+    /// - Parameters:
+    ///     - desired: The value to replace the receiver with.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    public func exchange(_ desired: Pointee, order: AtomicMemoryOrder = .seqcst) -> Pointee {
+        return CAtomicDoubleWordExchange(self, desired, order)
+    }
+
+    /// Atomically compares the value pointed to by the receiver with the
+    /// value pointed to by `expected`, and if those are equal, replaces the
+    /// former with `desired` (performs *read-modify-write* operation).
+    /// Otherwise, loads the actual value pointed to by the receiver into
+    /// `*expected` (performs *load* operation).
+    ///
+    /// - Parameters:
+    ///     - expected: The value expected to be found in the receiver.
+    ///     - desired: The value to store in the receiver if it is as expected.
+    ///     - order: The memory synchronization ordering for the read-modify-write
+    ///       operation if the comparison succeeds.
+    ///     - loadOrder: The memory synchronization ordering for the load
+    ///       operation if the comparison fails. Cannot specify stronger
+    ///       ordering than `order`.
+    ///
+    /// - Returns: The result of the comparison: `true` if current value was
+    ///     equal to `*expected`, `false` otherwise.
+    @_transparent
+    @discardableResult
+    public func compareExchange(
+        _ expected: UnsafeMutablePointer<Pointee>,
+        _ desired: Pointee,
+        order: AtomicMemoryOrder = .seqcst,
+        loadOrder: AtomicLoadMemoryOrder? = nil
+    ) -> Bool {
+        let loadOrder = loadOrder ?? order.strongestLoadOrder()
+        return CAtomicDoubleWordCompareExchangeStrong(
+            self, expected, desired, order, loadOrder
+        )
+    }
+
+    /// Atomically compares the value pointed to by the receiver with the
+    /// value pointed to by `expected`, and if those are equal, replaces the
+    /// former with `desired` (performs *read-modify-write* operation).
+    /// Otherwise, loads the actual value pointed to by the receiver into
+    /// `*expected` (performs *load* operation).
+    ///
+    /// - Parameters:
+    ///     - expected: The value expected to be found in the receiver.
+    ///     - desired: The value to store in the receiver if it is as expected.
+    ///     - order: The memory synchronization ordering for the read-modify-write
+    ///       operation if the comparison succeeds.
+    ///     - loadOrder: The memory synchronization ordering for the load
+    ///       operation if the comparison fails. Cannot specify stronger
+    ///       ordering than `order`.
+    ///
+    /// - Returns: The value actually stored in the receiver. If exchange
+    ///     succeeded, this will be equal to `expected`.
+    @_transparent
+    @discardableResult
+    public func compareExchange(
+        _ expected: Pointee,
+        _ desired: Pointee,
+        order: AtomicMemoryOrder = .seqcst,
+        loadOrder: AtomicLoadMemoryOrder? = nil
+    ) -> Pointee {
+        var current = expected
+        let loadOrder = loadOrder ?? order.strongestLoadOrder()
+        _ = CAtomicDoubleWordCompareExchangeStrong(
+            self, &current, desired, order, loadOrder
+        )
+        return current
+    }
+
+    /// Atomically compares the value pointed to by the receiver with the
+    /// value pointed to by `expected`, and if those are equal, replaces the
+    /// former with `desired` (performs *read-modify-write* operation).
+    /// Otherwise, loads the actual value pointed to by the receiver into
+    /// `*expected` (performs *load* operation).
+    ///
+    /// This form of compare-and-exchange is allowed to fail spuriously, that
+    /// is, act as if `*current != *expected` even if they are equal. When a
+    /// compare-and-exchange is in a loop, this version will yield better
+    /// performance on some platforms. When a weak compare-and-exchange would
+    /// require a loop and a strong one would not, the strong one is preferable.
+    ///
+    /// - Parameters:
+    ///     - expected: The value expected to be found in the receiver.
+    ///     - desired: The value to store in the receiver if it is as expected.
+    ///     - order: The memory synchronization ordering for the read-modify-write
+    ///       operation if the comparison succeeds.
+    ///     - loadOrder: The memory synchronization ordering for the load
+    ///       operation if the comparison fails. Cannot specify stronger
+    ///       ordering than `order`.
+    ///
+    /// - Returns: The result of the comparison: `true` if current value was
+    ///     equal to `*expected`, `false` otherwise.
+    @_transparent
+    @discardableResult
+    public func compareExchangeWeak(
+        _ expected: UnsafeMutablePointer<Pointee>,
+        _ desired: Pointee,
+        order: AtomicMemoryOrder = .seqcst,
+        loadOrder: AtomicLoadMemoryOrder? = nil
+    ) -> Bool {
+        let loadOrder = loadOrder ?? order.strongestLoadOrder()
+        return CAtomicDoubleWordCompareExchangeWeak(
+            self, expected, desired, order, loadOrder
+        )
+    }
+
+    /// Atomically compares the value pointed to by the receiver with the
+    /// value pointed to by `expected`, and if those are equal, replaces the
+    /// former with `desired` (performs *read-modify-write* operation).
+    /// Otherwise, loads the actual value pointed to by the receiver into
+    /// `*expected` (performs *load* operation).
+    ///
+    /// This form of compare-and-exchange is allowed to fail spuriously, that
+    /// is, act as if `*current != *expected` even if they are equal. When a
+    /// compare-and-exchange is in a loop, this version will yield better
+    /// performance on some platforms. When a weak compare-and-exchange would
+    /// require a loop and a strong one would not, the strong one is preferable.
+    ///
+    /// - Parameters:
+    ///     - expected: The value expected to be found in the receiver.
+    ///     - desired: The value to store in the receiver if it is as expected.
+    ///     - order: The memory synchronization ordering for the read-modify-write
+    ///       operation if the comparison succeeds.
+    ///     - loadOrder: The memory synchronization ordering for the load
+    ///       operation if the comparison fails. Cannot specify stronger
+    ///       ordering than `order`.
+    ///
+    /// - Returns: The value actually stored in the receiver. If exchange
+    ///     succeeded, this will be equal to `expected`.
+    @_transparent
+    @discardableResult
+    public func compareExchangeWeak(
+        _ expected: Pointee,
+        _ desired: Pointee,
+        order: AtomicMemoryOrder = .seqcst,
+        loadOrder: AtomicLoadMemoryOrder? = nil
+    ) -> Pointee {
+        var current = expected
+        let loadOrder = loadOrder ?? order.strongestLoadOrder()
+        _ = CAtomicDoubleWordCompareExchangeWeak(
+            self, &current, desired, order, loadOrder
+        )
+        return current
+    }
 }
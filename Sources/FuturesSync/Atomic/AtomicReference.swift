@@ -289,3 +289,112 @@ extension AtomicReference {
         return _fromOpaque(exp.bits)?.takeUnretainedValue()
     }
 }
+
+// MARK: - Epoch-guarded access -
+
+/// Plain `load()` is only safe if no other thread can concurrently release
+/// the loaded object, i.e. via `store` or `exchange`, between the atomic
+/// load and the retain of the returned reference. The methods below close
+/// that window by deferring the release of replaced objects until no thread
+/// that might have loaded them is still pinned; see `Epoch`.
+///
+/// When a reference is read with `load(guard:)`, all writes to it must be
+/// performed via the guarded methods; mixing them with unguarded writes
+/// is unsafe.
+extension AtomicReference {
+    @_transparent
+    public func load(guard pin: EpochGuard, order: AtomicLoadMemoryOrder = .seqcst) -> T? {
+        return AtomicReference.load(&_storage, guard: pin, order: order)
+    }
+
+    @_transparent
+    public func store(_ obj: T?, guard pin: EpochGuard, order: AtomicStoreMemoryOrder = .seqcst) {
+        AtomicReference.store(&_storage, obj, guard: pin, order: order)
+    }
+
+    @_transparent
+    public func exchange(_ obj: T?, guard pin: EpochGuard, order: AtomicMemoryOrder = .seqcst) -> T? {
+        return AtomicReference.exchange(&_storage, obj, guard: pin, order: order)
+    }
+
+    @_transparent
+    @discardableResult
+    public func compareExchange(
+        _ expected: T?,
+        _ desired: T?,
+        guard pin: EpochGuard,
+        order: AtomicMemoryOrder = .seqcst,
+        loadOrder: AtomicLoadMemoryOrder? = nil
+    ) -> T? {
+        return AtomicReference.compareExchange(
+            &_storage,
+            expected,
+            desired,
+            guard: pin,
+            order: order,
+            loadOrder: loadOrder
+        )
+    }
+}
+
+extension AtomicReference {
+    @_transparent
+    public static func load(_ ref: Pointer, guard pin: EpochGuard, order: AtomicLoadMemoryOrder = .seqcst) -> T? {
+        // The object cannot be released while we're pinned, so it's safe
+        // to retain it after the load.
+        return load(ref, order: order)
+    }
+
+    @_transparent
+    public static func store(_ ref: Pointer, _ obj: T?, guard pin: EpochGuard, order: AtomicStoreMemoryOrder = .seqcst) {
+        // swiftlint:disable:next force_unwrapping
+        let order = AtomicMemoryOrder(rawValue: order.rawValue)!
+        let desired = _toOpaqueRetained(obj)
+        let current = AtomicUSize.exchange(ref, desired.bits, order: order)
+        if let ptr = _fromOpaque(current, as: T.self) {
+            pin.deferRelease(ptr)
+        }
+    }
+
+    @_transparent
+    public static func exchange(_ ref: Pointer, _ obj: T?, guard pin: EpochGuard, order: AtomicMemoryOrder = .seqcst) -> T? {
+        let desired = _toOpaqueRetained(obj)
+        let current = AtomicUSize.exchange(ref, desired.bits, order: order)
+        guard let ptr = _fromOpaque(current, as: T.self) else {
+            return nil
+        }
+        let previous = ptr.takeUnretainedValue()
+        pin.deferRelease(ptr)
+        return previous
+    }
+
+    @_transparent
+    @discardableResult
+    public static func compareExchange(
+        _ ref: Pointer,
+        _ expected: T?,
+        _ desired: T?,
+        guard pin: EpochGuard,
+        order: AtomicMemoryOrder = .seqcst,
+        loadOrder: AtomicLoadMemoryOrder? = nil
+    ) -> T? {
+        var exp = _toOpaque(expected)
+        let des = _toOpaque(desired)
+        if AtomicUSize.compareExchange(
+            ref,
+            &exp.bits,
+            des.bits,
+            order: order,
+            loadOrder: loadOrder ?? order.strongestLoadOrder()
+        ) {
+            _ = des.ptr?.retain()
+            if let ptr = exp.ptr {
+                pin.deferRelease(ptr)
+            }
+            return withExtendedLifetime(desired) {
+                expected
+            }
+        }
+        return _fromOpaque(exp.bits)?.takeUnretainedValue()
+    }
+}
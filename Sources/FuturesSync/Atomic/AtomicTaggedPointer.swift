@@ -0,0 +1,167 @@
+//
+//  AtomicTaggedPointer.swift
+//  Futures
+//
+//  Copyright © 2019 Akis Kesoglou. Licensed under the MIT license.
+//
+
+/// A pointer paired with a word-sized tag.
+///
+/// Lock-free structures that compare-and-exchange pointers are susceptible
+/// to the ABA problem: a thread loads pointer A, gets preempted while other
+/// threads replace A with B and then A again (e.g. after recycling A's
+/// memory), and on resumption erroneously succeeds in exchanging A. Bumping
+/// the tag on every update makes the pair unique even if the pointer value
+/// recurs, so the stale exchange fails.
+public struct TaggedPointer<Pointee>: Equatable {
+    public var pointer: UnsafeMutablePointer<Pointee>?
+    public var tag: UInt
+
+    @inlinable
+    public init(_ pointer: UnsafeMutablePointer<Pointee>?, tag: UInt = 0) {
+        self.pointer = pointer
+        self.tag = tag
+    }
+
+    /// Returns a tagged pointer to `pointer`, with a tag one greater than
+    /// the receiver's, wrapping around on overflow.
+    @inlinable
+    public func successor(_ pointer: UnsafeMutablePointer<Pointee>?) -> TaggedPointer {
+        return .init(pointer, tag: tag &+ 1)
+    }
+
+    @inlinable
+    init(_rawValue: DoubleWord) {
+        pointer = UnsafeMutablePointer(bitPattern: _rawValue.first)
+        tag = _rawValue.second
+    }
+
+    @inlinable
+    var _rawValue: DoubleWord {
+        return .init(first: UInt(bitPattern: pointer), second: tag)
+    }
+}
+
+/// An atomic `TaggedPointer`, built on double-word atomic operations.
+///
+/// See `AtomicDoubleWord.isLockFree` for whether operations are lock-free
+/// on the current platform.
+public final class AtomicTaggedPointer<Pointee> {
+    public typealias Pointer = AtomicDoubleWord.Pointer
+    public typealias RawValue = AtomicDoubleWord.RawValue
+    public typealias Value = TaggedPointer<Pointee>
+
+    @usableFromInline var _storage = RawValue()
+
+    @inlinable
+    public init(_ initialValue: Value = .init(nil)) {
+        AtomicTaggedPointer.initialize(&_storage, to: initialValue)
+    }
+}
+
+extension AtomicTaggedPointer {
+    @_transparent
+    public func load(order: AtomicLoadMemoryOrder = .seqcst) -> Value {
+        return AtomicTaggedPointer.load(&_storage, order: order)
+    }
+
+    @_transparent
+    public func store(_ desired: Value, order: AtomicStoreMemoryOrder = .seqcst) {
+        AtomicTaggedPointer.store(&_storage, desired, order: order)
+    }
+
+    @_transparent
+    public func exchange(_ desired: Value, order: AtomicMemoryOrder = .seqcst) -> Value {
+        return AtomicTaggedPointer.exchange(&_storage, desired, order: order)
+    }
+
+    @_transparent
+    @discardableResult
+    public func compareExchange(
+        _ expected: UnsafeMutablePointer<Value>,
+        _ desired: Value,
+        order: AtomicMemoryOrder = .seqcst,
+        loadOrder: AtomicLoadMemoryOrder? = nil
+    ) -> Bool {
+        return AtomicTaggedPointer.compareExchange(
+            &_storage,
+            expected,
+            desired,
+            order: order,
+            loadOrder: loadOrder
+        )
+    }
+
+    @_transparent
+    @discardableResult
+    public func compareExchangeWeak(
+        _ expected: UnsafeMutablePointer<Value>,
+        _ desired: Value,
+        order: AtomicMemoryOrder = .seqcst,
+        loadOrder: AtomicLoadMemoryOrder? = nil
+    ) -> Bool {
+        return AtomicTaggedPointer.compareExchangeWeak(
+            &_storage,
+            expected,
+            desired,
+            order: order,
+            loadOrder: loadOrder
+        )
+    }
+}
+
+extension AtomicTaggedPointer {
+    @_transparent
+    public static func initialize(_ ptr: Pointer, to initialValue: Value) {
+        AtomicDoubleWord.initialize(ptr, to: initialValue._rawValue)
+    }
+
+    @_transparent
+    public static func load(_ ptr: Pointer, order: AtomicLoadMemoryOrder = .seqcst) -> Value {
+        return .init(_rawValue: AtomicDoubleWord.load(ptr, order: order))
+    }
+
+    @_transparent
+    public static func store(_ ptr: Pointer, _ desired: Value, order: AtomicStoreMemoryOrder = .seqcst) {
+        AtomicDoubleWord.store(ptr, desired._rawValue, order: order)
+    }
+
+    @_transparent
+    public static func exchange(_ ptr: Pointer, _ desired: Value, order: AtomicMemoryOrder = .seqcst) -> Value {
+        return .init(_rawValue: AtomicDoubleWord.exchange(ptr, desired._rawValue, order: order))
+    }
+
+    @_transparent
+    @discardableResult
+    public static func compareExchange(
+        _ ptr: Pointer,
+        _ expected: UnsafeMutablePointer<Value>,
+        _ desired: Value,
+        order: AtomicMemoryOrder = .seqcst,
+        loadOrder: AtomicLoadMemoryOrder? = nil
+    ) -> Bool {
+        var current = expected.pointee._rawValue
+        if AtomicDoubleWord.compareExchange(ptr, &current, desired._rawValue, order: order, loadOrder: loadOrder) {
+            return true
+        }
+        expected.pointee = .init(_rawValue: current)
+        return false
+    }
+
+    @_transparent
+    @discardableResult
+    public static func compareExchangeWeak(
+        _ ptr: Pointer,
+        _ expected: UnsafeMutablePointer<Value>,
+        _ desired: Value,
+        order: AtomicMemoryOrder = .seqcst,
+        loadOrder: AtomicLoadMemoryOrder? = nil
+    ) -> Bool {
+        var current = expected.pointee._rawValue
+        if AtomicDoubleWord.compareExchangeWeak(ptr, &current, desired._rawValue, order: order, loadOrder: loadOrder) {
+            return true
+        }
+        expected.pointee = .init(_rawValue: current)
+        return false
+    }
+}
@@ -792,6 +792,40 @@ extension AtomicInt {
     public func fetchSub(_ value: RawValue, order: AtomicMemoryOrder = .seqcst) -> RawValue {
         return AtomicInt.fetchSub(&_storage, value, order: order)
     }
+
+    /// Atomically replaces the value pointed by the receiver with the minimum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already less than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMin(_ value: RawValue, order: AtomicMemoryOrder = .seqcst) -> RawValue {
+        return AtomicInt.fetchMin(&_storage, value, order: order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the maximum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already greater than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMax(_ value: RawValue, order: AtomicMemoryOrder = .seqcst) -> RawValue {
+        return AtomicInt.fetchMax(&_storage, value, order: order)
+    }
 }
 
 extension AtomicInt {
@@ -1057,6 +1091,40 @@ extension AtomicInt {
     public static func fetchSub(_ ptr: Pointer, _ value: Int, order: AtomicMemoryOrder = .seqcst) -> Int {
         return ptr.fetchSub(value, order: order)
     }
+
+    /// Atomically replaces the value pointed by the receiver with the minimum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already less than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public static func fetchMin(_ ptr: Pointer, _ value: Int, order: AtomicMemoryOrder = .seqcst) -> Int {
+        return ptr.fetchMin(value, order: order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the maximum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already greater than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public static func fetchMax(_ ptr: Pointer, _ value: Int, order: AtomicMemoryOrder = .seqcst) -> Int {
+        return ptr.fetchMax(value, order: order)
+    }
 }
 
 // MARK: - Int8 -
@@ -1360,6 +1428,40 @@ extension AtomicInt8 {
     public func fetchSub(_ value: RawValue, order: AtomicMemoryOrder = .seqcst) -> RawValue {
         return AtomicInt8.fetchSub(&_storage, value, order: order)
     }
+
+    /// Atomically replaces the value pointed by the receiver with the minimum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already less than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMin(_ value: RawValue, order: AtomicMemoryOrder = .seqcst) -> RawValue {
+        return AtomicInt8.fetchMin(&_storage, value, order: order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the maximum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already greater than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMax(_ value: RawValue, order: AtomicMemoryOrder = .seqcst) -> RawValue {
+        return AtomicInt8.fetchMax(&_storage, value, order: order)
+    }
 }
 
 extension AtomicInt8 {
@@ -1625,6 +1727,40 @@ extension AtomicInt8 {
     public static func fetchSub(_ ptr: Pointer, _ value: Int8, order: AtomicMemoryOrder = .seqcst) -> Int8 {
         return ptr.fetchSub(value, order: order)
     }
+
+    /// Atomically replaces the value pointed by the receiver with the minimum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already less than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public static func fetchMin(_ ptr: Pointer, _ value: Int8, order: AtomicMemoryOrder = .seqcst) -> Int8 {
+        return ptr.fetchMin(value, order: order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the maximum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already greater than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public static func fetchMax(_ ptr: Pointer, _ value: Int8, order: AtomicMemoryOrder = .seqcst) -> Int8 {
+        return ptr.fetchMax(value, order: order)
+    }
 }
 
 // MARK: - Int16 -
@@ -1928,6 +2064,40 @@ extension AtomicInt16 {
     public func fetchSub(_ value: RawValue, order: AtomicMemoryOrder = .seqcst) -> RawValue {
         return AtomicInt16.fetchSub(&_storage, value, order: order)
     }
+
+    /// Atomically replaces the value pointed by the receiver with the minimum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already less than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMin(_ value: RawValue, order: AtomicMemoryOrder = .seqcst) -> RawValue {
+        return AtomicInt16.fetchMin(&_storage, value, order: order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the maximum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already greater than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMax(_ value: RawValue, order: AtomicMemoryOrder = .seqcst) -> RawValue {
+        return AtomicInt16.fetchMax(&_storage, value, order: order)
+    }
 }
 
 extension AtomicInt16 {
@@ -2193,6 +2363,40 @@ extension AtomicInt16 {
     public static func fetchSub(_ ptr: Pointer, _ value: Int16, order: AtomicMemoryOrder = .seqcst) -> Int16 {
         return ptr.fetchSub(value, order: order)
     }
+
+    /// Atomically replaces the value pointed by the receiver with the minimum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already less than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public static func fetchMin(_ ptr: Pointer, _ value: Int16, order: AtomicMemoryOrder = .seqcst) -> Int16 {
+        return ptr.fetchMin(value, order: order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the maximum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already greater than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public static func fetchMax(_ ptr: Pointer, _ value: Int16, order: AtomicMemoryOrder = .seqcst) -> Int16 {
+        return ptr.fetchMax(value, order: order)
+    }
 }
 
 // MARK: - Int32 -
@@ -2496,6 +2700,40 @@ extension AtomicInt32 {
     public func fetchSub(_ value: RawValue, order: AtomicMemoryOrder = .seqcst) -> RawValue {
         return AtomicInt32.fetchSub(&_storage, value, order: order)
     }
+
+    /// Atomically replaces the value pointed by the receiver with the minimum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already less than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMin(_ value: RawValue, order: AtomicMemoryOrder = .seqcst) -> RawValue {
+        return AtomicInt32.fetchMin(&_storage, value, order: order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the maximum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already greater than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMax(_ value: RawValue, order: AtomicMemoryOrder = .seqcst) -> RawValue {
+        return AtomicInt32.fetchMax(&_storage, value, order: order)
+    }
 }
 
 extension AtomicInt32 {
@@ -2761,6 +2999,40 @@ extension AtomicInt32 {
     public static func fetchSub(_ ptr: Pointer, _ value: Int32, order: AtomicMemoryOrder = .seqcst) -> Int32 {
         return ptr.fetchSub(value, order: order)
     }
+
+    /// Atomically replaces the value pointed by the receiver with the minimum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already less than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public static func fetchMin(_ ptr: Pointer, _ value: Int32, order: AtomicMemoryOrder = .seqcst) -> Int32 {
+        return ptr.fetchMin(value, order: order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the maximum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already greater than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public static func fetchMax(_ ptr: Pointer, _ value: Int32, order: AtomicMemoryOrder = .seqcst) -> Int32 {
+        return ptr.fetchMax(value, order: order)
+    }
 }
 
 // MARK: - Int64 -
@@ -3064,6 +3336,40 @@ extension AtomicInt64 {
     public func fetchSub(_ value: RawValue, order: AtomicMemoryOrder = .seqcst) -> RawValue {
         return AtomicInt64.fetchSub(&_storage, value, order: order)
     }
+
+    /// Atomically replaces the value pointed by the receiver with the minimum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already less than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMin(_ value: RawValue, order: AtomicMemoryOrder = .seqcst) -> RawValue {
+        return AtomicInt64.fetchMin(&_storage, value, order: order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the maximum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already greater than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMax(_ value: RawValue, order: AtomicMemoryOrder = .seqcst) -> RawValue {
+        return AtomicInt64.fetchMax(&_storage, value, order: order)
+    }
 }
 
 extension AtomicInt64 {
@@ -3329,6 +3635,40 @@ extension AtomicInt64 {
     public static func fetchSub(_ ptr: Pointer, _ value: Int64, order: AtomicMemoryOrder = .seqcst) -> Int64 {
         return ptr.fetchSub(value, order: order)
     }
+
+    /// Atomically replaces the value pointed by the receiver with the minimum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already less than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public static func fetchMin(_ ptr: Pointer, _ value: Int64, order: AtomicMemoryOrder = .seqcst) -> Int64 {
+        return ptr.fetchMin(value, order: order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the maximum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already greater than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public static func fetchMax(_ ptr: Pointer, _ value: Int64, order: AtomicMemoryOrder = .seqcst) -> Int64 {
+        return ptr.fetchMax(value, order: order)
+    }
 }
 
 // MARK: - UInt -
@@ -3632,6 +3972,40 @@ extension AtomicUInt {
     public func fetchSub(_ value: RawValue, order: AtomicMemoryOrder = .seqcst) -> RawValue {
         return AtomicUInt.fetchSub(&_storage, value, order: order)
     }
+
+    /// Atomically replaces the value pointed by the receiver with the minimum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already less than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMin(_ value: RawValue, order: AtomicMemoryOrder = .seqcst) -> RawValue {
+        return AtomicUInt.fetchMin(&_storage, value, order: order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the maximum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already greater than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMax(_ value: RawValue, order: AtomicMemoryOrder = .seqcst) -> RawValue {
+        return AtomicUInt.fetchMax(&_storage, value, order: order)
+    }
 }
 
 extension AtomicUInt {
@@ -3897,6 +4271,40 @@ extension AtomicUInt {
     public static func fetchSub(_ ptr: Pointer, _ value: UInt, order: AtomicMemoryOrder = .seqcst) -> UInt {
         return ptr.fetchSub(value, order: order)
     }
+
+    /// Atomically replaces the value pointed by the receiver with the minimum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already less than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public static func fetchMin(_ ptr: Pointer, _ value: UInt, order: AtomicMemoryOrder = .seqcst) -> UInt {
+        return ptr.fetchMin(value, order: order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the maximum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already greater than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public static func fetchMax(_ ptr: Pointer, _ value: UInt, order: AtomicMemoryOrder = .seqcst) -> UInt {
+        return ptr.fetchMax(value, order: order)
+    }
 }
 
 // MARK: - UInt8 -
@@ -4200,6 +4608,40 @@ extension AtomicUInt8 {
     public func fetchSub(_ value: RawValue, order: AtomicMemoryOrder = .seqcst) -> RawValue {
         return AtomicUInt8.fetchSub(&_storage, value, order: order)
     }
+
+    /// Atomically replaces the value pointed by the receiver with the minimum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already less than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMin(_ value: RawValue, order: AtomicMemoryOrder = .seqcst) -> RawValue {
+        return AtomicUInt8.fetchMin(&_storage, value, order: order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the maximum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already greater than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMax(_ value: RawValue, order: AtomicMemoryOrder = .seqcst) -> RawValue {
+        return AtomicUInt8.fetchMax(&_storage, value, order: order)
+    }
 }
 
 extension AtomicUInt8 {
@@ -4465,6 +4907,40 @@ extension AtomicUInt8 {
     public static func fetchSub(_ ptr: Pointer, _ value: UInt8, order: AtomicMemoryOrder = .seqcst) -> UInt8 {
         return ptr.fetchSub(value, order: order)
     }
+
+    /// Atomically replaces the value pointed by the receiver with the minimum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already less than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public static func fetchMin(_ ptr: Pointer, _ value: UInt8, order: AtomicMemoryOrder = .seqcst) -> UInt8 {
+        return ptr.fetchMin(value, order: order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the maximum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already greater than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public static func fetchMax(_ ptr: Pointer, _ value: UInt8, order: AtomicMemoryOrder = .seqcst) -> UInt8 {
+        return ptr.fetchMax(value, order: order)
+    }
 }
 
 // MARK: - UInt16 -
@@ -4768,11 +5244,45 @@ extension AtomicUInt16 {
     public func fetchSub(_ value: RawValue, order: AtomicMemoryOrder = .seqcst) -> RawValue {
         return AtomicUInt16.fetchSub(&_storage, value, order: order)
     }
-}
 
-extension AtomicUInt16 {
-    @_transparent
-    public static func initialize(_ ptr: Pointer, to initialValue: UInt16) {
+    /// Atomically replaces the value pointed by the receiver with the minimum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already less than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMin(_ value: RawValue, order: AtomicMemoryOrder = .seqcst) -> RawValue {
+        return AtomicUInt16.fetchMin(&_storage, value, order: order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the maximum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already greater than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMax(_ value: RawValue, order: AtomicMemoryOrder = .seqcst) -> RawValue {
+        return AtomicUInt16.fetchMax(&_storage, value, order: order)
+    }
+}
+
+extension AtomicUInt16 {
+    @_transparent
+    public static func initialize(_ ptr: Pointer, to initialValue: UInt16) {
         ptr.initialize(to: initialValue)
     }
 
@@ -5033,6 +5543,40 @@ extension AtomicUInt16 {
     public static func fetchSub(_ ptr: Pointer, _ value: UInt16, order: AtomicMemoryOrder = .seqcst) -> UInt16 {
         return ptr.fetchSub(value, order: order)
     }
+
+    /// Atomically replaces the value pointed by the receiver with the minimum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already less than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public static func fetchMin(_ ptr: Pointer, _ value: UInt16, order: AtomicMemoryOrder = .seqcst) -> UInt16 {
+        return ptr.fetchMin(value, order: order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the maximum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already greater than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public static func fetchMax(_ ptr: Pointer, _ value: UInt16, order: AtomicMemoryOrder = .seqcst) -> UInt16 {
+        return ptr.fetchMax(value, order: order)
+    }
 }
 
 // MARK: - UInt32 -
@@ -5336,6 +5880,40 @@ extension AtomicUInt32 {
     public func fetchSub(_ value: RawValue, order: AtomicMemoryOrder = .seqcst) -> RawValue {
         return AtomicUInt32.fetchSub(&_storage, value, order: order)
     }
+
+    /// Atomically replaces the value pointed by the receiver with the minimum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already less than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMin(_ value: RawValue, order: AtomicMemoryOrder = .seqcst) -> RawValue {
+        return AtomicUInt32.fetchMin(&_storage, value, order: order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the maximum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already greater than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMax(_ value: RawValue, order: AtomicMemoryOrder = .seqcst) -> RawValue {
+        return AtomicUInt32.fetchMax(&_storage, value, order: order)
+    }
 }
 
 extension AtomicUInt32 {
@@ -5601,6 +6179,40 @@ extension AtomicUInt32 {
     public static func fetchSub(_ ptr: Pointer, _ value: UInt32, order: AtomicMemoryOrder = .seqcst) -> UInt32 {
         return ptr.fetchSub(value, order: order)
     }
+
+    /// Atomically replaces the value pointed by the receiver with the minimum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already less than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public static func fetchMin(_ ptr: Pointer, _ value: UInt32, order: AtomicMemoryOrder = .seqcst) -> UInt32 {
+        return ptr.fetchMin(value, order: order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the maximum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already greater than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public static func fetchMax(_ ptr: Pointer, _ value: UInt32, order: AtomicMemoryOrder = .seqcst) -> UInt32 {
+        return ptr.fetchMax(value, order: order)
+    }
 }
 
 // MARK: - UInt64 -
@@ -5904,6 +6516,40 @@ extension AtomicUInt64 {
     public func fetchSub(_ value: RawValue, order: AtomicMemoryOrder = .seqcst) -> RawValue {
         return AtomicUInt64.fetchSub(&_storage, value, order: order)
     }
+
+    /// Atomically replaces the value pointed by the receiver with the minimum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already less than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMin(_ value: RawValue, order: AtomicMemoryOrder = .seqcst) -> RawValue {
+        return AtomicUInt64.fetchMin(&_storage, value, order: order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the maximum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already greater than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMax(_ value: RawValue, order: AtomicMemoryOrder = .seqcst) -> RawValue {
+        return AtomicUInt64.fetchMax(&_storage, value, order: order)
+    }
 }
 
 extension AtomicUInt64 {
@@ -6169,4 +6815,1488 @@ extension AtomicUInt64 {
     public static func fetchSub(_ ptr: Pointer, _ value: UInt64, order: AtomicMemoryOrder = .seqcst) -> UInt64 {
         return ptr.fetchSub(value, order: order)
     }
+
+    /// Atomically replaces the value pointed by the receiver with the minimum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already less than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public static func fetchMin(_ ptr: Pointer, _ value: UInt64, order: AtomicMemoryOrder = .seqcst) -> UInt64 {
+        return ptr.fetchMin(value, order: order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the maximum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already greater than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public static func fetchMax(_ ptr: Pointer, _ value: UInt64, order: AtomicMemoryOrder = .seqcst) -> UInt64 {
+        return ptr.fetchMax(value, order: order)
+    }
+}
+
+// MARK: - Float -
+
+extension Swift.Float: _CAtomicValue {
+    public typealias AtomicRawValue = CAtomicFloat
+    public typealias AtomicPointer = AtomicFloatPointer
+}
+
+public final class AtomicFloat {
+    public typealias Pointer = AtomicFloatPointer
+    public typealias RawValue = CAtomicFloat
+
+    @usableFromInline var _storage: RawValue = 0
+
+    @inlinable
+    init() {}
+}
+
+extension AtomicFloat {
+    @_transparent
+    public convenience init(_ initialValue: RawValue) {
+        self.init()
+        AtomicFloat.initialize(&_storage, to: initialValue)
+    }
+
+    /// Atomically loads and returns the current value of the atomic variable
+    /// pointed to by the receiver. The operation is atomic *read* operation.
+    ///
+    /// - Parameters:
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value stored in the receiver.
+    @_transparent
+    public func load(order: AtomicLoadMemoryOrder = .seqcst) -> RawValue {
+        return AtomicFloat.load(&_storage, order: order)
+    }
+
+    /// Atomically replaces the value of the atomic variable pointed to by the
+    /// receiver with `desired`. The operation is atomic *write* operation.
+    ///
+    /// - Parameters:
+    ///     - desired: The value to replace the receiver with.
+    ///     - order: The memory synchronization ordering for this operation.
+    @_transparent
+    public func store(_ desired: RawValue, order: AtomicStoreMemoryOrder = .seqcst) {
+        AtomicFloat.store(&_storage, desired, order: order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with `desired`
+    /// and returns the value the receiver held previously. The operation is
+    /// *read-modify-write* operation.
+    ///
+    /// - Parameters:
+    ///     - desired: The value to replace the receiver with.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    public func exchange(_ desired: RawValue, order: AtomicMemoryOrder = .seqcst) -> RawValue {
+        return AtomicFloat.exchange(&_storage, desired, order: order)
+    }
+
+    /// Atomically compares the value pointed to by the receiver with the
+    /// value pointed to by `expected`, and if those are equal, replaces the
+    /// former with `desired` (performs *read-modify-write* operation).
+    /// Otherwise, loads the actual value pointed to by the receiver into
+    /// `*expected` (performs *load* operation).
+    ///
+    /// - Parameters:
+    ///     - expected: The value expected to be found in the receiver.
+    ///     - desired: The value to store in the receiver if it is as expected.
+    ///     - order: The memory synchronization ordering for the read-modify-write
+    ///       operation if the comparison succeeds.
+    ///     - loadOrder: The memory synchronization ordering for the load
+    ///       operation if the comparison fails. Cannot specify stronger
+    ///       ordering than `order`.
+    ///
+    /// - Returns: The result of the comparison: `true` if current value was
+    ///     equal to `*expected`, `false` otherwise.
+    @_transparent
+    @discardableResult
+    public func compareExchange(
+        _ expected: UnsafeMutablePointer<RawValue>,
+        _ desired: RawValue,
+        order: AtomicMemoryOrder = .seqcst,
+        loadOrder: AtomicLoadMemoryOrder? = nil
+    ) -> Bool {
+        return AtomicFloat.compareExchange(
+            &_storage,
+            expected,
+            desired,
+            order: order,
+            loadOrder: loadOrder
+        )
+    }
+
+    /// Atomically compares the value pointed to by the receiver with the
+    /// value pointed to by `expected`, and if those are equal, replaces the
+    /// former with `desired` (performs *read-modify-write* operation).
+    /// Otherwise, loads the actual value pointed to by the receiver into
+    /// `*expected` (performs *load* operation).
+    ///
+    /// - Parameters:
+    ///     - expected: The value expected to be found in the receiver.
+    ///     - desired: The value to store in the receiver if it is as expected.
+    ///     - order: The memory synchronization ordering for the read-modify-write
+    ///       operation if the comparison succeeds.
+    ///     - loadOrder: The memory synchronization ordering for the load
+    ///       operation if the comparison fails. Cannot specify stronger
+    ///       ordering than `order`.
+    ///
+    /// - Returns: The value actually stored in the receiver. If exchange
+    ///     succeeded, this will be equal to `expected`.
+    @_transparent
+    @discardableResult
+    public func compareExchange(
+        _ expected: RawValue,
+        _ desired: RawValue,
+        order: AtomicMemoryOrder = .seqcst,
+        loadOrder: AtomicLoadMemoryOrder? = nil
+    ) -> RawValue {
+        return AtomicFloat.compareExchange(
+            &_storage,
+            expected,
+            desired,
+            order: order,
+            loadOrder: loadOrder
+        )
+    }
+
+    /// Atomically compares the value pointed to by the receiver with the
+    /// value pointed to by `expected`, and if those are equal, replaces the
+    /// former with `desired` (performs *read-modify-write* operation).
+    /// Otherwise, loads the actual value pointed to by the receiver into
+    /// `*expected` (performs *load* operation).
+    ///
+    /// This form of compare-and-exchange is allowed to fail spuriously, that
+    /// is, act as if `*current != *expected` even if they are equal. When a
+    /// compare-and-exchange is in a loop, this version will yield better
+    /// performance on some platforms. When a weak compare-and-exchange would
+    /// require a loop and a strong one would not, the strong one is preferable.
+    ///
+    /// - Parameters:
+    ///     - expected: The value expected to be found in the receiver.
+    ///     - desired: The value to store in the receiver if it is as expected.
+    ///     - order: The memory synchronization ordering for the read-modify-write
+    ///       operation if the comparison succeeds.
+    ///     - loadOrder: The memory synchronization ordering for the load
+    ///       operation if the comparison fails. Cannot specify stronger
+    ///       ordering than `order`.
+    ///
+    /// - Returns: The result of the comparison: `true` if current value was
+    ///     equal to `*expected`, `false` otherwise.
+    @_transparent
+    @discardableResult
+    public func compareExchangeWeak(
+        _ expected: UnsafeMutablePointer<RawValue>,
+        _ desired: RawValue,
+        order: AtomicMemoryOrder = .seqcst,
+        loadOrder: AtomicLoadMemoryOrder? = nil
+    ) -> Bool {
+        return AtomicFloat.compareExchangeWeak(
+            &_storage,
+            expected,
+            desired,
+            order: order,
+            loadOrder: loadOrder
+        )
+    }
+
+    /// Atomically compares the value pointed to by the receiver with the
+    /// value pointed to by `expected`, and if those are equal, replaces the
+    /// former with `desired` (performs *read-modify-write* operation).
+    /// Otherwise, loads the actual value pointed to by the receiver into
+    /// `*expected` (performs *load* operation).
+    ///
+    /// This form of compare-and-exchange is allowed to fail spuriously, that
+    /// is, act as if `*current != *expected` even if they are equal. When a
+    /// compare-and-exchange is in a loop, this version will yield better
+    /// performance on some platforms. When a weak compare-and-exchange would
+    /// require a loop and a strong one would not, the strong one is preferable.
+    ///
+    /// - Parameters:
+    ///     - expected: The value expected to be found in the receiver.
+    ///     - desired: The value to store in the receiver if it is as expected.
+    ///     - order: The memory synchronization ordering for the read-modify-write
+    ///       operation if the comparison succeeds.
+    ///     - loadOrder: The memory synchronization ordering for the load
+    ///       operation if the comparison fails. Cannot specify stronger
+    ///       ordering than `order`.
+    ///
+    /// - Returns: The value actually stored in the receiver. If exchange
+    ///     succeeded, this will be equal to `expected`.
+    @_transparent
+    @discardableResult
+    public func compareExchangeWeak(
+        _ expected: RawValue,
+        _ desired: RawValue,
+        order: AtomicMemoryOrder = .seqcst,
+        loadOrder: AtomicLoadMemoryOrder? = nil
+    ) -> RawValue {
+        return AtomicFloat.compareExchangeWeak(
+            &_storage,
+            expected,
+            desired,
+            order: order,
+            loadOrder: loadOrder
+        )
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the result
+    /// of addition of `value` to the old value of the receiver, and returns
+    /// the value the receiver held previously. The operation is *read-modify-write*
+    /// operation.
+    ///
+    /// For signed integer types, arithmetic is defined to use two’s
+    /// complement representation. There are no undefined results. For pointer
+    /// types, the result may be an undefined address, but the operations
+    /// otherwise have no undefined behavior.
+    ///
+    /// - Parameters:
+    ///     - value: The value to add to the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchAdd(_ value: RawValue, order: AtomicMemoryOrder = .seqcst) -> RawValue {
+        return AtomicFloat.fetchAdd(&_storage, value, order: order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the result
+    /// of subtraction of `value` to the old value of the receiver, and returns
+    /// the value the receiver held previously. The operation is *read-modify-write*
+    /// operation.
+    ///
+    /// For signed integer types, arithmetic is defined to use two’s complement
+    /// representation. There are no undefined results. For pointer types, the
+    /// result may be an undefined address, but the operations otherwise have
+    /// no undefined behavior.
+    ///
+    /// - Parameters:
+    ///     - value: The value to subtract from the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchSub(_ value: RawValue, order: AtomicMemoryOrder = .seqcst) -> RawValue {
+        return AtomicFloat.fetchSub(&_storage, value, order: order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the minimum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already less than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMin(_ value: RawValue, order: AtomicMemoryOrder = .seqcst) -> RawValue {
+        return AtomicFloat.fetchMin(&_storage, value, order: order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the maximum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already greater than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMax(_ value: RawValue, order: AtomicMemoryOrder = .seqcst) -> RawValue {
+        return AtomicFloat.fetchMax(&_storage, value, order: order)
+    }
+}
+
+extension AtomicFloat {
+    @_transparent
+    public static func initialize(_ ptr: Pointer, to initialValue: Float) {
+        ptr.initialize(to: initialValue)
+    }
+
+    /// Atomically loads and returns the current value of the atomic variable
+    /// pointed to by the receiver. The operation is atomic *read* operation.
+    ///
+    /// - Parameters:
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value stored in the receiver.
+    @_transparent
+    public static func load(_ ptr: Pointer, order: AtomicLoadMemoryOrder = .seqcst) -> Float {
+        return ptr.load(order: order)
+    }
+
+    /// Atomically replaces the value of the atomic variable pointed to by the
+    /// receiver with `desired`. The operation is atomic *write* operation.
+    ///
+    /// - Parameters:
+    ///     - desired: The value to replace the receiver with.
+    ///     - order: The memory synchronization ordering for this operation.
+    @_transparent
+    public static func store(_ ptr: Pointer, _ desired: Float, order: AtomicStoreMemoryOrder = .seqcst) {
+        ptr.store(desired, order: order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with `desired`
+    /// and returns the value the receiver held previously. The operation is
+    /// *read-modify-write* operation.
+    ///
+    /// - Parameters:
+    ///     - desired: The value to replace the receiver with.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    public static func exchange(_ ptr: Pointer, _ desired: Float, order: AtomicMemoryOrder = .seqcst) -> Float {
+        return ptr.exchange(desired, order: order)
+    }
+
+    /// Atomically compares the value pointed to by the receiver with the
+    /// value pointed to by `expected`, and if those are equal, replaces the
+    /// former with `desired` (performs *read-modify-write* operation).
+    /// Otherwise, loads the actual value pointed to by the receiver into
+    /// `*expected` (performs *load* operation).
+    ///
+    /// - Parameters:
+    ///     - expected: The value expected to be found in the receiver.
+    ///     - desired: The value to store in the receiver if it is as expected.
+    ///     - order: The memory synchronization ordering for the read-modify-write
+    ///       operation if the comparison succeeds.
+    ///     - loadOrder: The memory synchronization ordering for the load
+    ///       operation if the comparison fails. Cannot specify stronger
+    ///       ordering than `order`.
+    ///
+    /// - Returns: The result of the comparison: `true` if current value was
+    ///     equal to `*expected`, `false` otherwise.
+    @_transparent
+    @discardableResult
+    public static func compareExchange(
+        _ ptr: Pointer,
+        _ expected: UnsafeMutablePointer<Float>,
+        _ desired: Float,
+        order: AtomicMemoryOrder = .seqcst,
+        loadOrder: AtomicLoadMemoryOrder? = nil
+    ) -> Bool {
+        return ptr.compareExchange(expected, desired, order: order, loadOrder: loadOrder)
+    }
+
+    /// Atomically compares the value pointed to by the receiver with the
+    /// value pointed to by `expected`, and if those are equal, replaces the
+    /// former with `desired` (performs *read-modify-write* operation).
+    /// Otherwise, loads the actual value pointed to by the receiver into
+    /// `*expected` (performs *load* operation).
+    ///
+    /// - Parameters:
+    ///     - expected: The value expected to be found in the receiver.
+    ///     - desired: The value to store in the receiver if it is as expected.
+    ///     - order: The memory synchronization ordering for the read-modify-write
+    ///       operation if the comparison succeeds.
+    ///     - loadOrder: The memory synchronization ordering for the load
+    ///       operation if the comparison fails. Cannot specify stronger
+    ///       ordering than `order`.
+    ///
+    /// - Returns: The value actually stored in the receiver. If exchange
+    ///     succeeded, this will be equal to `expected`.
+    @_transparent
+    @discardableResult
+    public static func compareExchange(
+        _ ptr: Pointer,
+        _ expected: Float,
+        _ desired: Float,
+        order: AtomicMemoryOrder = .seqcst,
+        loadOrder: AtomicLoadMemoryOrder? = nil
+    ) -> Float {
+        return ptr.compareExchange(expected, desired, order: order, loadOrder: loadOrder)
+    }
+
+    /// Atomically compares the value pointed to by the receiver with the
+    /// value pointed to by `expected`, and if those are equal, replaces the
+    /// former with `desired` (performs *read-modify-write* operation).
+    /// Otherwise, loads the actual value pointed to by the receiver into
+    /// `*expected` (performs *load* operation).
+    ///
+    /// This form of compare-and-exchange is allowed to fail spuriously, that
+    /// is, act as if `*current != *expected` even if they are equal. When a
+    /// compare-and-exchange is in a loop, this version will yield better
+    /// performance on some platforms. When a weak compare-and-exchange would
+    /// require a loop and a strong one would not, the strong one is preferable.
+    ///
+    /// - Parameters:
+    ///     - expected: The value expected to be found in the receiver.
+    ///     - desired: The value to store in the receiver if it is as expected.
+    ///     - order: The memory synchronization ordering for the read-modify-write
+    ///       operation if the comparison succeeds.
+    ///     - loadOrder: The memory synchronization ordering for the load
+    ///       operation if the comparison fails. Cannot specify stronger
+    ///       ordering than `order`.
+    ///
+    /// - Returns: The result of the comparison: `true` if current value was
+    ///     equal to `*expected`, `false` otherwise.
+    @_transparent
+    @discardableResult
+    public static func compareExchangeWeak(
+        _ ptr: Pointer,
+        _ expected: UnsafeMutablePointer<Float>,
+        _ desired: Float,
+        order: AtomicMemoryOrder = .seqcst,
+        loadOrder: AtomicLoadMemoryOrder? = nil
+    ) -> Bool {
+        return ptr.compareExchangeWeak(expected, desired, order: order, loadOrder: loadOrder)
+    }
+
+    /// Atomically compares the value pointed to by the receiver with the
+    /// value pointed to by `expected`, and if those are equal, replaces the
+    /// former with `desired` (performs *read-modify-write* operation).
+    /// Otherwise, loads the actual value pointed to by the receiver into
+    /// `*expected` (performs *load* operation).
+    ///
+    /// This form of compare-and-exchange is allowed to fail spuriously, that
+    /// is, act as if `*current != *expected` even if they are equal. When a
+    /// compare-and-exchange is in a loop, this version will yield better
+    /// performance on some platforms. When a weak compare-and-exchange would
+    /// require a loop and a strong one would not, the strong one is preferable.
+    ///
+    /// - Parameters:
+    ///     - expected: The value expected to be found in the receiver.
+    ///     - desired: The value to store in the receiver if it is as expected.
+    ///     - order: The memory synchronization ordering for the read-modify-write
+    ///       operation if the comparison succeeds.
+    ///     - loadOrder: The memory synchronization ordering for the load
+    ///       operation if the comparison fails. Cannot specify stronger
+    ///       ordering than `order`.
+    ///
+    /// - Returns: The value actually stored in the receiver. If exchange
+    ///     succeeded, this will be equal to `expected`.
+    @_transparent
+    @discardableResult
+    public static func compareExchangeWeak(
+        _ ptr: Pointer,
+        _ expected: Float,
+        _ desired: Float,
+        order: AtomicMemoryOrder = .seqcst,
+        loadOrder: AtomicLoadMemoryOrder? = nil
+    ) -> Float {
+        return ptr.compareExchangeWeak(expected, desired, order: order, loadOrder: loadOrder)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the result
+    /// of addition of `value` to the old value of the receiver, and returns
+    /// the value the receiver held previously. The operation is *read-modify-write*
+    /// operation.
+    ///
+    /// For signed integer types, arithmetic is defined to use two’s
+    /// complement representation. There are no undefined results. For pointer
+    /// types, the result may be an undefined address, but the operations
+    /// otherwise have no undefined behavior.
+    ///
+    /// - Parameters:
+    ///     - value: The value to add to the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public static func fetchAdd(_ ptr: Pointer, _ value: Float, order: AtomicMemoryOrder = .seqcst) -> Float {
+        return ptr.fetchAdd(value, order: order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the result
+    /// of subtraction of `value` to the old value of the receiver, and returns
+    /// the value the receiver held previously. The operation is *read-modify-write*
+    /// operation.
+    ///
+    /// For signed integer types, arithmetic is defined to use two’s complement
+    /// representation. There are no undefined results. For pointer types, the
+    /// result may be an undefined address, but the operations otherwise have
+    /// no undefined behavior.
+    ///
+    /// - Parameters:
+    ///     - value: The value to subtract from the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public static func fetchSub(_ ptr: Pointer, _ value: Float, order: AtomicMemoryOrder = .seqcst) -> Float {
+        return ptr.fetchSub(value, order: order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the minimum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already less than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public static func fetchMin(_ ptr: Pointer, _ value: Float, order: AtomicMemoryOrder = .seqcst) -> Float {
+        return ptr.fetchMin(value, order: order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the maximum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already greater than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public static func fetchMax(_ ptr: Pointer, _ value: Float, order: AtomicMemoryOrder = .seqcst) -> Float {
+        return ptr.fetchMax(value, order: order)
+    }
+}
+
+// MARK: - Double -
+
+extension Swift.Double: _CAtomicValue {
+    public typealias AtomicRawValue = CAtomicDouble
+    public typealias AtomicPointer = AtomicDoublePointer
+}
+
+public final class AtomicDouble {
+    public typealias Pointer = AtomicDoublePointer
+    public typealias RawValue = CAtomicDouble
+
+    @usableFromInline var _storage: RawValue = 0
+
+    @inlinable
+    init() {}
+}
+
+extension AtomicDouble {
+    @_transparent
+    public convenience init(_ initialValue: RawValue) {
+        self.init()
+        AtomicDouble.initialize(&_storage, to: initialValue)
+    }
+
+    /// Atomically loads and returns the current value of the atomic variable
+    /// pointed to by the receiver. The operation is atomic *read* operation.
+    ///
+    /// - Parameters:
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value stored in the receiver.
+    @_transparent
+    public func load(order: AtomicLoadMemoryOrder = .seqcst) -> RawValue {
+        return AtomicDouble.load(&_storage, order: order)
+    }
+
+    /// Atomically replaces the value of the atomic variable pointed to by the
+    /// receiver with `desired`. The operation is atomic *write* operation.
+    ///
+    /// - Parameters:
+    ///     - desired: The value to replace the receiver with.
+    ///     - order: The memory synchronization ordering for this operation.
+    @_transparent
+    public func store(_ desired: RawValue, order: AtomicStoreMemoryOrder = .seqcst) {
+        AtomicDouble.store(&_storage, desired, order: order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with `desired`
+    /// and returns the value the receiver held previously. The operation is
+    /// *read-modify-write* operation.
+    ///
+    /// - Parameters:
+    ///     - desired: The value to replace the receiver with.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    public func exchange(_ desired: RawValue, order: AtomicMemoryOrder = .seqcst) -> RawValue {
+        return AtomicDouble.exchange(&_storage, desired, order: order)
+    }
+
+    /// Atomically compares the value pointed to by the receiver with the
+    /// value pointed to by `expected`, and if those are equal, replaces the
+    /// former with `desired` (performs *read-modify-write* operation).
+    /// Otherwise, loads the actual value pointed to by the receiver into
+    /// `*expected` (performs *load* operation).
+    ///
+    /// - Parameters:
+    ///     - expected: The value expected to be found in the receiver.
+    ///     - desired: The value to store in the receiver if it is as expected.
+    ///     - order: The memory synchronization ordering for the read-modify-write
+    ///       operation if the comparison succeeds.
+    ///     - loadOrder: The memory synchronization ordering for the load
+    ///       operation if the comparison fails. Cannot specify stronger
+    ///       ordering than `order`.
+    ///
+    /// - Returns: The result of the comparison: `true` if current value was
+    ///     equal to `*expected`, `false` otherwise.
+    @_transparent
+    @discardableResult
+    public func compareExchange(
+        _ expected: UnsafeMutablePointer<RawValue>,
+        _ desired: RawValue,
+        order: AtomicMemoryOrder = .seqcst,
+        loadOrder: AtomicLoadMemoryOrder? = nil
+    ) -> Bool {
+        return AtomicDouble.compareExchange(
+            &_storage,
+            expected,
+            desired,
+            order: order,
+            loadOrder: loadOrder
+        )
+    }
+
+    /// Atomically compares the value pointed to by the receiver with the
+    /// value pointed to by `expected`, and if those are equal, replaces the
+    /// former with `desired` (performs *read-modify-write* operation).
+    /// Otherwise, loads the actual value pointed to by the receiver into
+    /// `*expected` (performs *load* operation).
+    ///
+    /// - Parameters:
+    ///     - expected: The value expected to be found in the receiver.
+    ///     - desired: The value to store in the receiver if it is as expected.
+    ///     - order: The memory synchronization ordering for the read-modify-write
+    ///       operation if the comparison succeeds.
+    ///     - loadOrder: The memory synchronization ordering for the load
+    ///       operation if the comparison fails. Cannot specify stronger
+    ///       ordering than `order`.
+    ///
+    /// - Returns: The value actually stored in the receiver. If exchange
+    ///     succeeded, this will be equal to `expected`.
+    @_transparent
+    @discardableResult
+    public func compareExchange(
+        _ expected: RawValue,
+        _ desired: RawValue,
+        order: AtomicMemoryOrder = .seqcst,
+        loadOrder: AtomicLoadMemoryOrder? = nil
+    ) -> RawValue {
+        return AtomicDouble.compareExchange(
+            &_storage,
+            expected,
+            desired,
+            order: order,
+            loadOrder: loadOrder
+        )
+    }
+
+    /// Atomically compares the value pointed to by the receiver with the
+    /// value pointed to by `expected`, and if those are equal, replaces the
+    /// former with `desired` (performs *read-modify-write* operation).
+    /// Otherwise, loads the actual value pointed to by the receiver into
+    /// `*expected` (performs *load* operation).
+    ///
+    /// This form of compare-and-exchange is allowed to fail spuriously, that
+    /// is, act as if `*current != *expected` even if they are equal. When a
+    /// compare-and-exchange is in a loop, this version will yield better
+    /// performance on some platforms. When a weak compare-and-exchange would
+    /// require a loop and a strong one would not, the strong one is preferable.
+    ///
+    /// - Parameters:
+    ///     - expected: The value expected to be found in the receiver.
+    ///     - desired: The value to store in the receiver if it is as expected.
+    ///     - order: The memory synchronization ordering for the read-modify-write
+    ///       operation if the comparison succeeds.
+    ///     - loadOrder: The memory synchronization ordering for the load
+    ///       operation if the comparison fails. Cannot specify stronger
+    ///       ordering than `order`.
+    ///
+    /// - Returns: The result of the comparison: `true` if current value was
+    ///     equal to `*expected`, `false` otherwise.
+    @_transparent
+    @discardableResult
+    public func compareExchangeWeak(
+        _ expected: UnsafeMutablePointer<RawValue>,
+        _ desired: RawValue,
+        order: AtomicMemoryOrder = .seqcst,
+        loadOrder: AtomicLoadMemoryOrder? = nil
+    ) -> Bool {
+        return AtomicDouble.compareExchangeWeak(
+            &_storage,
+            expected,
+            desired,
+            order: order,
+            loadOrder: loadOrder
+        )
+    }
+
+    /// Atomically compares the value pointed to by the receiver with the
+    /// value pointed to by `expected`, and if those are equal, replaces the
+    /// former with `desired` (performs *read-modify-write* operation).
+    /// Otherwise, loads the actual value pointed to by the receiver into
+    /// `*expected` (performs *load* operation).
+    ///
+    /// This form of compare-and-exchange is allowed to fail spuriously, that
+    /// is, act as if `*current != *expected` even if they are equal. When a
+    /// compare-and-exchange is in a loop, this version will yield better
+    /// performance on some platforms. When a weak compare-and-exchange would
+    /// require a loop and a strong one would not, the strong one is preferable.
+    ///
+    /// - Parameters:
+    ///     - expected: The value expected to be found in the receiver.
+    ///     - desired: The value to store in the receiver if it is as expected.
+    ///     - order: The memory synchronization ordering for the read-modify-write
+    ///       operation if the comparison succeeds.
+    ///     - loadOrder: The memory synchronization ordering for the load
+    ///       operation if the comparison fails. Cannot specify stronger
+    ///       ordering than `order`.
+    ///
+    /// - Returns: The value actually stored in the receiver. If exchange
+    ///     succeeded, this will be equal to `expected`.
+    @_transparent
+    @discardableResult
+    public func compareExchangeWeak(
+        _ expected: RawValue,
+        _ desired: RawValue,
+        order: AtomicMemoryOrder = .seqcst,
+        loadOrder: AtomicLoadMemoryOrder? = nil
+    ) -> RawValue {
+        return AtomicDouble.compareExchangeWeak(
+            &_storage,
+            expected,
+            desired,
+            order: order,
+            loadOrder: loadOrder
+        )
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the result
+    /// of addition of `value` to the old value of the receiver, and returns
+    /// the value the receiver held previously. The operation is *read-modify-write*
+    /// operation.
+    ///
+    /// For signed integer types, arithmetic is defined to use two’s
+    /// complement representation. There are no undefined results. For pointer
+    /// types, the result may be an undefined address, but the operations
+    /// otherwise have no undefined behavior.
+    ///
+    /// - Parameters:
+    ///     - value: The value to add to the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchAdd(_ value: RawValue, order: AtomicMemoryOrder = .seqcst) -> RawValue {
+        return AtomicDouble.fetchAdd(&_storage, value, order: order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the result
+    /// of subtraction of `value` to the old value of the receiver, and returns
+    /// the value the receiver held previously. The operation is *read-modify-write*
+    /// operation.
+    ///
+    /// For signed integer types, arithmetic is defined to use two’s complement
+    /// representation. There are no undefined results. For pointer types, the
+    /// result may be an undefined address, but the operations otherwise have
+    /// no undefined behavior.
+    ///
+    /// - Parameters:
+    ///     - value: The value to subtract from the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchSub(_ value: RawValue, order: AtomicMemoryOrder = .seqcst) -> RawValue {
+        return AtomicDouble.fetchSub(&_storage, value, order: order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the minimum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already less than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMin(_ value: RawValue, order: AtomicMemoryOrder = .seqcst) -> RawValue {
+        return AtomicDouble.fetchMin(&_storage, value, order: order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the maximum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already greater than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public func fetchMax(_ value: RawValue, order: AtomicMemoryOrder = .seqcst) -> RawValue {
+        return AtomicDouble.fetchMax(&_storage, value, order: order)
+    }
+}
+
+extension AtomicDouble {
+    @_transparent
+    public static func initialize(_ ptr: Pointer, to initialValue: Double) {
+        ptr.initialize(to: initialValue)
+    }
+
+    /// Atomically loads and returns the current value of the atomic variable
+    /// pointed to by the receiver. The operation is atomic *read* operation.
+    ///
+    /// - Parameters:
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value stored in the receiver.
+    @_transparent
+    public static func load(_ ptr: Pointer, order: AtomicLoadMemoryOrder = .seqcst) -> Double {
+        return ptr.load(order: order)
+    }
+
+    /// Atomically replaces the value of the atomic variable pointed to by the
+    /// receiver with `desired`. The operation is atomic *write* operation.
+    ///
+    /// - Parameters:
+    ///     - desired: The value to replace the receiver with.
+    ///     - order: The memory synchronization ordering for this operation.
+    @_transparent
+    public static func store(_ ptr: Pointer, _ desired: Double, order: AtomicStoreMemoryOrder = .seqcst) {
+        ptr.store(desired, order: order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with `desired`
+    /// and returns the value the receiver held previously. The operation is
+    /// *read-modify-write* operation.
+    ///
+    /// - Parameters:
+    ///     - desired: The value to replace the receiver with.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    public static func exchange(_ ptr: Pointer, _ desired: Double, order: AtomicMemoryOrder = .seqcst) -> Double {
+        return ptr.exchange(desired, order: order)
+    }
+
+    /// Atomically compares the value pointed to by the receiver with the
+    /// value pointed to by `expected`, and if those are equal, replaces the
+    /// former with `desired` (performs *read-modify-write* operation).
+    /// Otherwise, loads the actual value pointed to by the receiver into
+    /// `*expected` (performs *load* operation).
+    ///
+    /// - Parameters:
+    ///     - expected: The value expected to be found in the receiver.
+    ///     - desired: The value to store in the receiver if it is as expected.
+    ///     - order: The memory synchronization ordering for the read-modify-write
+    ///       operation if the comparison succeeds.
+    ///     - loadOrder: The memory synchronization ordering for the load
+    ///       operation if the comparison fails. Cannot specify stronger
+    ///       ordering than `order`.
+    ///
+    /// - Returns: The result of the comparison: `true` if current value was
+    ///     equal to `*expected`, `false` otherwise.
+    @_transparent
+    @discardableResult
+    public static func compareExchange(
+        _ ptr: Pointer,
+        _ expected: UnsafeMutablePointer<Double>,
+        _ desired: Double,
+        order: AtomicMemoryOrder = .seqcst,
+        loadOrder: AtomicLoadMemoryOrder? = nil
+    ) -> Bool {
+        return ptr.compareExchange(expected, desired, order: order, loadOrder: loadOrder)
+    }
+
+    /// Atomically compares the value pointed to by the receiver with the
+    /// value pointed to by `expected`, and if those are equal, replaces the
+    /// former with `desired` (performs *read-modify-write* operation).
+    /// Otherwise, loads the actual value pointed to by the receiver into
+    /// `*expected` (performs *load* operation).
+    ///
+    /// - Parameters:
+    ///     - expected: The value expected to be found in the receiver.
+    ///     - desired: The value to store in the receiver if it is as expected.
+    ///     - order: The memory synchronization ordering for the read-modify-write
+    ///       operation if the comparison succeeds.
+    ///     - loadOrder: The memory synchronization ordering for the load
+    ///       operation if the comparison fails. Cannot specify stronger
+    ///       ordering than `order`.
+    ///
+    /// - Returns: The value actually stored in the receiver. If exchange
+    ///     succeeded, this will be equal to `expected`.
+    @_transparent
+    @discardableResult
+    public static func compareExchange(
+        _ ptr: Pointer,
+        _ expected: Double,
+        _ desired: Double,
+        order: AtomicMemoryOrder = .seqcst,
+        loadOrder: AtomicLoadMemoryOrder? = nil
+    ) -> Double {
+        return ptr.compareExchange(expected, desired, order: order, loadOrder: loadOrder)
+    }
+
+    /// Atomically compares the value pointed to by the receiver with the
+    /// value pointed to by `expected`, and if those are equal, replaces the
+    /// former with `desired` (performs *read-modify-write* operation).
+    /// Otherwise, loads the actual value pointed to by the receiver into
+    /// `*expected` (performs *load* operation).
+    ///
+    /// This form of compare-and-exchange is allowed to fail spuriously, that
+    /// is, act as if `*current != *expected` even if they are equal. When a
+    /// compare-and-exchange is in a loop, this version will yield better
+    /// performance on some platforms. When a weak compare-and-exchange would
+    /// require a loop and a strong one would not, the strong one is preferable.
+    ///
+    /// - Parameters:
+    ///     - expected: The value expected to be found in the receiver.
+    ///     - desired: The value to store in the receiver if it is as expected.
+    ///     - order: The memory synchronization ordering for the read-modify-write
+    ///       operation if the comparison succeeds.
+    ///     - loadOrder: The memory synchronization ordering for the load
+    ///       operation if the comparison fails. Cannot specify stronger
+    ///       ordering than `order`.
+    ///
+    /// - Returns: The result of the comparison: `true` if current value was
+    ///     equal to `*expected`, `false` otherwise.
+    @_transparent
+    @discardableResult
+    public static func compareExchangeWeak(
+        _ ptr: Pointer,
+        _ expected: UnsafeMutablePointer<Double>,
+        _ desired: Double,
+        order: AtomicMemoryOrder = .seqcst,
+        loadOrder: AtomicLoadMemoryOrder? = nil
+    ) -> Bool {
+        return ptr.compareExchangeWeak(expected, desired, order: order, loadOrder: loadOrder)
+    }
+
+    /// Atomically compares the value pointed to by the receiver with the
+    /// value pointed to by `expected`, and if those are equal, replaces the
+    /// former with `desired` (performs *read-modify-write* operation).
+    /// Otherwise, loads the actual value pointed to by the receiver into
+    /// `*expected` (performs *load* operation).
+    ///
+    /// This form of compare-and-exchange is allowed to fail spuriously, that
+    /// is, act as if `*current != *expected` even if they are equal. When a
+    /// compare-and-exchange is in a loop, this version will yield better
+    /// performance on some platforms. When a weak compare-and-exchange would
+    /// require a loop and a strong one would not, the strong one is preferable.
+    ///
+    /// - Parameters:
+    ///     - expected: The value expected to be found in the receiver.
+    ///     - desired: The value to store in the receiver if it is as expected.
+    ///     - order: The memory synchronization ordering for the read-modify-write
+    ///       operation if the comparison succeeds.
+    ///     - loadOrder: The memory synchronization ordering for the load
+    ///       operation if the comparison fails. Cannot specify stronger
+    ///       ordering than `order`.
+    ///
+    /// - Returns: The value actually stored in the receiver. If exchange
+    ///     succeeded, this will be equal to `expected`.
+    @_transparent
+    @discardableResult
+    public static func compareExchangeWeak(
+        _ ptr: Pointer,
+        _ expected: Double,
+        _ desired: Double,
+        order: AtomicMemoryOrder = .seqcst,
+        loadOrder: AtomicLoadMemoryOrder? = nil
+    ) -> Double {
+        return ptr.compareExchangeWeak(expected, desired, order: order, loadOrder: loadOrder)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the result
+    /// of addition of `value` to the old value of the receiver, and returns
+    /// the value the receiver held previously. The operation is *read-modify-write*
+    /// operation.
+    ///
+    /// For signed integer types, arithmetic is defined to use two’s
+    /// complement representation. There are no undefined results. For pointer
+    /// types, the result may be an undefined address, but the operations
+    /// otherwise have no undefined behavior.
+    ///
+    /// - Parameters:
+    ///     - value: The value to add to the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public static func fetchAdd(_ ptr: Pointer, _ value: Double, order: AtomicMemoryOrder = .seqcst) -> Double {
+        return ptr.fetchAdd(value, order: order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the result
+    /// of subtraction of `value` to the old value of the receiver, and returns
+    /// the value the receiver held previously. The operation is *read-modify-write*
+    /// operation.
+    ///
+    /// For signed integer types, arithmetic is defined to use two’s complement
+    /// representation. There are no undefined results. For pointer types, the
+    /// result may be an undefined address, but the operations otherwise have
+    /// no undefined behavior.
+    ///
+    /// - Parameters:
+    ///     - value: The value to subtract from the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public static func fetchSub(_ ptr: Pointer, _ value: Double, order: AtomicMemoryOrder = .seqcst) -> Double {
+        return ptr.fetchSub(value, order: order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the minimum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already less than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public static func fetchMin(_ ptr: Pointer, _ value: Double, order: AtomicMemoryOrder = .seqcst) -> Double {
+        return ptr.fetchMin(value, order: order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with the maximum
+    /// of the old value of the receiver and `value`, and returns the value the
+    /// receiver held previously. The operation is *read-modify-write*
+    /// operation, implemented as a compare-and-exchange loop; if the stored
+    /// value is already greater than or equal to `value`, no write is performed.
+    ///
+    /// - Parameters:
+    ///     - value: The value to compare with the value stored in the receiver.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    @discardableResult
+    public static func fetchMax(_ ptr: Pointer, _ value: Double, order: AtomicMemoryOrder = .seqcst) -> Double {
+        return ptr.fetchMax(value, order: order)
+    }
+}
+
+// MARK: - DoubleWord -
+
+extension DoubleWord: _CAtomicValue {
+    public typealias AtomicRawValue = CAtomicDoubleWord
+    public typealias AtomicPointer = AtomicDoubleWordPointer
+}
+
+public final class AtomicDoubleWord {
+    public typealias Pointer = AtomicDoubleWordPointer
+    public typealias RawValue = CAtomicDoubleWord
+
+    @usableFromInline var _storage = RawValue()
+
+    @inlinable
+    init() {}
+}
+
+extension AtomicDoubleWord {
+    @_transparent
+    public convenience init(_ initialValue: RawValue) {
+        self.init()
+        AtomicDoubleWord.initialize(&_storage, to: initialValue)
+    }
+
+    /// Atomically loads and returns the current value of the atomic variable
+    /// pointed to by the receiver. The operation is atomic *read* operation.
+    ///
+    /// - Parameters:
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value stored in the receiver.
+    @_transparent
+    public func load(order: AtomicLoadMemoryOrder = .seqcst) -> RawValue {
+        return AtomicDoubleWord.load(&_storage, order: order)
+    }
+
+    /// Atomically replaces the value of the atomic variable pointed to by the
+    /// receiver with `desired`. The operation is atomic *write* operation.
+    ///
+    /// - Parameters:
+    ///     - desired: The value to replace the receiver with.
+    ///     - order: The memory synchronization ordering for this operation.
+    @_transparent
+    public func store(_ desired: RawValue, order: AtomicStoreMemoryOrder = .seqcst) {
+        AtomicDoubleWord.store(&_storage, desired, order: order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with `desired`
+    /// and returns the value the receiver held previously. The operation is
+    /// *read-modify-write* operation.
+    ///
+    /// - Parameters:
+    ///     - desired: The value to replace the receiver with.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    public func exchange(_ desired: RawValue, order: AtomicMemoryOrder = .seqcst) -> RawValue {
+        return AtomicDoubleWord.exchange(&_storage, desired, order: order)
+    }
+
+    /// Atomically compares the value pointed to by the receiver with the
+    /// value pointed to by `expected`, and if those are equal, replaces the
+    /// former with `desired` (performs *read-modify-write* operation).
+    /// Otherwise, loads the actual value pointed to by the receiver into
+    /// `*expected` (performs *load* operation).
+    ///
+    /// - Parameters:
+    ///     - expected: The value expected to be found in the receiver.
+    ///     - desired: The value to store in the receiver if it is as expected.
+    ///     - order: The memory synchronization ordering for the read-modify-write
+    ///       operation if the comparison succeeds.
+    ///     - loadOrder: The memory synchronization ordering for the load
+    ///       operation if the comparison fails. Cannot specify stronger
+    ///       ordering than `order`.
+    ///
+    /// - Returns: The result of the comparison: `true` if current value was
+    ///     equal to `*expected`, `false` otherwise.
+    @_transparent
+    @discardableResult
+    public func compareExchange(
+        _ expected: UnsafeMutablePointer<RawValue>,
+        _ desired: RawValue,
+        order: AtomicMemoryOrder = .seqcst,
+        loadOrder: AtomicLoadMemoryOrder? = nil
+    ) -> Bool {
+        return AtomicDoubleWord.compareExchange(
+            &_storage,
+            expected,
+            desired,
+            order: order,
+            loadOrder: loadOrder
+        )
+    }
+
+    /// Atomically compares the value pointed to by the receiver with the
+    /// value pointed to by `expected`, and if those are equal, replaces the
+    /// former with `desired` (performs *read-modify-write* operation).
+    /// Otherwise, loads the actual value pointed to by the receiver into
+    /// `*expected` (performs *load* operation).
+    ///
+    /// - Parameters:
+    ///     - expected: The value expected to be found in the receiver.
+    ///     - desired: The value to store in the receiver if it is as expected.
+    ///     - order: The memory synchronization ordering for the read-modify-write
+    ///       operation if the comparison succeeds.
+    ///     - loadOrder: The memory synchronization ordering for the load
+    ///       operation if the comparison fails. Cannot specify stronger
+    ///       ordering than `order`.
+    ///
+    /// - Returns: The value actually stored in the receiver. If exchange
+    ///     succeeded, this will be equal to `expected`.
+    @_transparent
+    @discardableResult
+    public func compareExchange(
+        _ expected: RawValue,
+        _ desired: RawValue,
+        order: AtomicMemoryOrder = .seqcst,
+        loadOrder: AtomicLoadMemoryOrder? = nil
+    ) -> RawValue {
+        return AtomicDoubleWord.compareExchange(
+            &_storage,
+            expected,
+            desired,
+            order: order,
+            loadOrder: loadOrder
+        )
+    }
+
+    /// Atomically compares the value pointed to by the receiver with the
+    /// value pointed to by `expected`, and if those are equal, replaces the
+    /// former with `desired` (performs *read-modify-write* operation).
+    /// Otherwise, loads the actual value pointed to by the receiver into
+    /// `*expected` (performs *load* operation).
+    ///
+    /// This form of compare-and-exchange is allowed to fail spuriously, that
+    /// is, act as if `*current != *expected` even if they are equal. When a
+    /// compare-and-exchange is in a loop, this version will yield better
+    /// performance on some platforms. When a weak compare-and-exchange would
+    /// require a loop and a strong one would not, the strong one is preferable.
+    ///
+    /// - Parameters:
+    ///     - expected: The value expected to be found in the receiver.
+    ///     - desired: The value to store in the receiver if it is as expected.
+    ///     - order: The memory synchronization ordering for the read-modify-write
+    ///       operation if the comparison succeeds.
+    ///     - loadOrder: The memory synchronization ordering for the load
+    ///       operation if the comparison fails. Cannot specify stronger
+    ///       ordering than `order`.
+    ///
+    /// - Returns: The result of the comparison: `true` if current value was
+    ///     equal to `*expected`, `false` otherwise.
+    @_transparent
+    @discardableResult
+    public func compareExchangeWeak(
+        _ expected: UnsafeMutablePointer<RawValue>,
+        _ desired: RawValue,
+        order: AtomicMemoryOrder = .seqcst,
+        loadOrder: AtomicLoadMemoryOrder? = nil
+    ) -> Bool {
+        return AtomicDoubleWord.compareExchangeWeak(
+            &_storage,
+            expected,
+            desired,
+            order: order,
+            loadOrder: loadOrder
+        )
+    }
+
+    /// Atomically compares the value pointed to by the receiver with the
+    /// value pointed to by `expected`, and if those are equal, replaces the
+    /// former with `desired` (performs *read-modify-write* operation).
+    /// Otherwise, loads the actual value pointed to by the receiver into
+    /// `*expected` (performs *load* operation).
+    ///
+    /// This form of compare-and-exchange is allowed to fail spuriously, that
+    /// is, act as if `*current != *expected` even if they are equal. When a
+    /// compare-and-exchange is in a loop, this version will yield better
+    /// performance on some platforms. When a weak compare-and-exchange would
+    /// require a loop and a strong one would not, the strong one is preferable.
+    ///
+    /// - Parameters:
+    ///     - expected: The value expected to be found in the receiver.
+    ///     - desired: The value to store in the receiver if it is as expected.
+    ///     - order: The memory synchronization ordering for the read-modify-write
+    ///       operation if the comparison succeeds.
+    ///     - loadOrder: The memory synchronization ordering for the load
+    ///       operation if the comparison fails. Cannot specify stronger
+    ///       ordering than `order`.
+    ///
+    /// - Returns: The value actually stored in the receiver. If exchange
+    ///     succeeded, this will be equal to `expected`.
+    @_transparent
+    @discardableResult
+    public func compareExchangeWeak(
+        _ expected: RawValue,
+        _ desired: RawValue,
+        order: AtomicMemoryOrder = .seqcst,
+        loadOrder: AtomicLoadMemoryOrder? = nil
+    ) -> RawValue {
+        return AtomicDoubleWord.compareExchangeWeak(
+            &_storage,
+            expected,
+            desired,
+            order: order,
+            loadOrder: loadOrder
+        )
+    }
+}
+
+extension AtomicDoubleWord {
+    @_transparent
+    public static func initialize(_ ptr: Pointer, to initialValue: DoubleWord) {
+        ptr.initialize(to: initialValue)
+    }
+
+    /// Atomically loads and returns the current value of the atomic variable
+    /// pointed to by the receiver. The operation is atomic *read* operation.
+    ///
+    /// - Parameters:
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value stored in the receiver.
+    @_transparent
+    public static func load(_ ptr: Pointer, order: AtomicLoadMemoryOrder = .seqcst) -> DoubleWord {
+        return ptr.load(order: order)
+    }
+
+    /// Atomically replaces the value of the atomic variable pointed to by the
+    /// receiver with `desired`. The operation is atomic *write* operation.
+    ///
+    /// - Parameters:
+    ///     - desired: The value to replace the receiver with.
+    ///     - order: The memory synchronization ordering for this operation.
+    @_transparent
+    public static func store(_ ptr: Pointer, _ desired: DoubleWord, order: AtomicStoreMemoryOrder = .seqcst) {
+        ptr.store(desired, order: order)
+    }
+
+    /// Atomically replaces the value pointed by the receiver with `desired`
+    /// and returns the value the receiver held previously. The operation is
+    /// *read-modify-write* operation.
+    ///
+    /// - Parameters:
+    ///     - desired: The value to replace the receiver with.
+    ///     - order: The memory synchronization ordering for this operation.
+    ///
+    /// - Returns: The value previously stored in the receiver.
+    @_transparent
+    public static func exchange(_ ptr: Pointer, _ desired: DoubleWord, order: AtomicMemoryOrder = .seqcst) -> DoubleWord {
+        return ptr.exchange(desired, order: order)
+    }
+
+    /// Atomically compares the value pointed to by the receiver with the
+    /// value pointed to by `expected`, and if those are equal, replaces the
+    /// former with `desired` (performs *read-modify-write* operation).
+    /// Otherwise, loads the actual value pointed to by the receiver into
+    /// `*expected` (performs *load* operation).
+    ///
+    /// - Parameters:
+    ///     - expected: The value expected to be found in the receiver.
+    ///     - desired: The value to store in the receiver if it is as expected.
+    ///     - order: The memory synchronization ordering for the read-modify-write
+    ///       operation if the comparison succeeds.
+    ///     - loadOrder: The memory synchronization ordering for the load
+    ///       operation if the comparison fails. Cannot specify stronger
+    ///       ordering than `order`.
+    ///
+    /// - Returns: The result of the comparison: `true` if current value was
+    ///     equal to `*expected`, `false` otherwise.
+    @_transparent
+    @discardableResult
+    public static func compareExchange(
+        _ ptr: Pointer,
+        _ expected: UnsafeMutablePointer<DoubleWord>,
+        _ desired: DoubleWord,
+        order: AtomicMemoryOrder = .seqcst,
+        loadOrder: AtomicLoadMemoryOrder? = nil
+    ) -> Bool {
+        return ptr.compareExchange(expected, desired, order: order, loadOrder: loadOrder)
+    }
+
+    /// Atomically compares the value pointed to by the receiver with the
+    /// value pointed to by `expected`, and if those are equal, replaces the
+    /// former with `desired` (performs *read-modify-write* operation).
+    /// Otherwise, loads the actual value pointed to by the receiver into
+    /// `*expected` (performs *load* operation).
+    ///
+    /// - Parameters:
+    ///     - expected: The value expected to be found in the receiver.
+    ///     - desired: The value to store in the receiver if it is as expected.
+    ///     - order: The memory synchronization ordering for the read-modify-write
+    ///       operation if the comparison succeeds.
+    ///     - loadOrder: The memory synchronization ordering for the load
+    ///       operation if the comparison fails. Cannot specify stronger
+    ///       ordering than `order`.
+    ///
+    /// - Returns: The value actually stored in the receiver. If exchange
+    ///     succeeded, this will be equal to `expected`.
+    @_transparent
+    @discardableResult
+    public static func compareExchange(
+        _ ptr: Pointer,
+        _ expected: DoubleWord,
+        _ desired: DoubleWord,
+        order: AtomicMemoryOrder = .seqcst,
+        loadOrder: AtomicLoadMemoryOrder? = nil
+    ) -> DoubleWord {
+        return ptr.compareExchange(expected, desired, order: order, loadOrder: loadOrder)
+    }
+
+    /// Atomically compares the value pointed to by the receiver with the
+    /// value pointed to by `expected`, and if those are equal, replaces the
+    /// former with `desired` (performs *read-modify-write* operation).
+    /// Otherwise, loads the actual value pointed to by the receiver into
+    /// `*expected` (performs *load* operation).
+    ///
+    /// This form of compare-and-exchange is allowed to fail spuriously, that
+    /// is, act as if `*current != *expected` even if they are equal. When a
+    /// compare-and-exchange is in a loop, this version will yield better
+    /// performance on some platforms. When a weak compare-and-exchange would
+    /// require a loop and a strong one would not, the strong one is preferable.
+    ///
+    /// - Parameters:
+    ///     - expected: The value expected to be found in the receiver.
+    ///     - desired: The value to store in the receiver if it is as expected.
+    ///     - order: The memory synchronization ordering for the read-modify-write
+    ///       operation if the comparison succeeds.
+    ///     - loadOrder: The memory synchronization ordering for the load
+    ///       operation if the comparison fails. Cannot specify stronger
+    ///       ordering than `order`.
+    ///
+    /// - Returns: The result of the comparison: `true` if current value was
+    ///     equal to `*expected`, `false` otherwise.
+    @_transparent
+    @discardableResult
+    public static func compareExchangeWeak(
+        _ ptr: Pointer,
+        _ expected: UnsafeMutablePointer<DoubleWord>,
+        _ desired: DoubleWord,
+        order: AtomicMemoryOrder = .seqcst,
+        loadOrder: AtomicLoadMemoryOrder? = nil
+    ) -> Bool {
+        return ptr.compareExchangeWeak(expected, desired, order: order, loadOrder: loadOrder)
+    }
+
+    /// Atomically compares the value pointed to by the receiver with the
+    /// value pointed to by `expected`, and if those are equal, replaces the
+    /// former with `desired` (performs *read-modify-write* operation).
+    /// Otherwise, loads the actual value pointed to by the receiver into
+    /// `*expected` (performs *load* operation).
+    ///
+    /// This form of compare-and-exchange is allowed to fail spuriously, that
+    /// is, act as if `*current != *expected` even if they are equal. When a
+    /// compare-and-exchange is in a loop, this version will yield better
+    /// performance on some platforms. When a weak compare-and-exchange would
+    /// require a loop and a strong one would not, the strong one is preferable.
+    ///
+    /// - Parameters:
+    ///     - expected: The value expected to be found in the receiver.
+    ///     - desired: The value to store in the receiver if it is as expected.
+    ///     - order: The memory synchronization ordering for the read-modify-write
+    ///       operation if the comparison succeeds.
+    ///     - loadOrder: The memory synchronization ordering for the load
+    ///       operation if the comparison fails. Cannot specify stronger
+    ///       ordering than `order`.
+    ///
+    /// - Returns: The value actually stored in the receiver. If exchange
+    ///     succeeded, this will be equal to `expected`.
+    @_transparent
+    @discardableResult
+    public static func compareExchangeWeak(
+        _ ptr: Pointer,
+        _ expected: DoubleWord,
+        _ desired: DoubleWord,
+        order: AtomicMemoryOrder = .seqcst,
+        loadOrder: AtomicLoadMemoryOrder? = nil
+    ) -> DoubleWord {
+        return ptr.compareExchangeWeak(expected, desired, order: order, loadOrder: loadOrder)
+    }
 }
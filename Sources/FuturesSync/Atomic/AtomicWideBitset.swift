@@ -0,0 +1,145 @@
+//
+//  AtomicWideBitset.swift
+//  Futures
+//
+//  Copyright © 2019 Akis Kesoglou. Licensed under the MIT license.
+//
+
+/// A fixed-size bitset of arbitrary width, whose bits can be atomically set,
+/// cleared and tested individually.
+///
+/// In addition to the bits themselves, the bitset maintains a summary word
+/// for every `UInt.bitWidth` words, with each bit of the summary denoting
+/// whether the corresponding word may contain set bits. This allows a
+/// consumer to find all set bits via `drainSetBits(_:)` in time proportional
+/// to the number of set bits rather than the size of the bitset, which makes
+/// it suitable for tracking readiness over a large number of sources.
+///
+/// Any number of threads may set, clear and drain bits concurrently. A bit
+/// that is set concurrently with a drain is either reported by that drain
+/// or remains set for the next one.
+public final class AtomicWideBitset {
+    /// The number of bits in the bitset.
+    public let count: Int
+
+    @usableFromInline let _words: AtomicUInt.Pointer
+    @usableFromInline let _wordCount: Int
+    @usableFromInline let _summary: AtomicUInt.Pointer
+    @usableFromInline let _summaryCount: Int
+
+    /// Creates a bitset of `count` bits, all initially clear.
+    @inlinable
+    public init(count: Int) {
+        precondition(count >= 0, "count must not be negative")
+        let wordCount = (count + UInt.bitWidth - 1) / UInt.bitWidth
+        let summaryCount = (wordCount + UInt.bitWidth - 1) / UInt.bitWidth
+        self.count = count
+        _wordCount = wordCount
+        _summaryCount = summaryCount
+        _words = .allocate(capacity: wordCount + summaryCount)
+        _words.initialize(repeating: 0, count: wordCount + summaryCount)
+        _summary = _words + wordCount
+    }
+
+    @inlinable
+    deinit {
+        _words.deinitialize(count: _wordCount + _summaryCount)
+        _words.deallocate()
+    }
+
+    /// Atomically sets the bit at `index`.
+    ///
+    /// - Returns: `true` if the bit was previously clear.
+    @inlinable
+    @discardableResult
+    public func set(_ index: Int) -> Bool {
+        precondition(index >= 0 && index < count, "index out of range")
+        let (word, mask) = AtomicWideBitset._locate(index)
+        let old = AtomicUInt.fetchOr(_words + word, mask, order: .acqrel)
+        if old == 0 {
+            // The word was empty, so its summary bit may be clear. If the
+            // word wasn't empty, either the summary bit is already set or
+            // a consumer is about to drain the word, observing our bit.
+            let (summary, summaryMask) = AtomicWideBitset._locate(word)
+            AtomicUInt.fetchOr(_summary + summary, summaryMask, order: .release)
+        }
+        return old & mask == 0
+    }
+
+    /// Atomically clears the bit at `index`.
+    @inlinable
+    public func clear(_ index: Int) {
+        _ = testAndClear(index)
+    }
+
+    /// Atomically clears the bit at `index`.
+    ///
+    /// - Returns: `true` if the bit was previously set.
+    @inlinable
+    @discardableResult
+    public func testAndClear(_ index: Int) -> Bool {
+        precondition(index >= 0 && index < count, "index out of range")
+        let (word, mask) = AtomicWideBitset._locate(index)
+        // The summary bit is left as is; it is cleared lazily when the
+        // empty word is encountered during a drain.
+        return AtomicUInt.fetchAnd(_words + word, ~mask, order: .acqrel) & mask != 0
+    }
+
+    /// Returns whether the bit at `index` is set.
+    @inlinable
+    public func test(_ index: Int) -> Bool {
+        precondition(index >= 0 && index < count, "index out of range")
+        let (word, mask) = AtomicWideBitset._locate(index)
+        return AtomicUInt.load(_words + word, order: .acquire) & mask != 0
+    }
+
+    /// A Boolean value indicating whether no bits are set.
+    @inlinable
+    public var isEmpty: Bool {
+        for i in 0..<_summaryCount {
+            var summary = AtomicUInt.load(_summary + i, order: .acquire)
+            while summary != 0 {
+                let word = i &* UInt.bitWidth &+ summary.trailingZeroBitCount
+                if AtomicUInt.load(_words + word, order: .acquire) != 0 {
+                    return false
+                }
+                summary &= summary &- 1
+            }
+        }
+        return true
+    }
+
+    /// Atomically clears all set bits, invoking `body` with the index of
+    /// each, in ascending order per word.
+    ///
+    /// Only words whose summary bit is set are visited, so the cost of a
+    /// drain is proportional to the number of set bits.
+    @inlinable
+    public func drainSetBits(_ body: (Int) -> Void) {
+        for i in 0..<_summaryCount {
+            if AtomicUInt.load(_summary + i, order: .relaxed) == 0 {
+                continue
+            }
+            // Clear the summary before the words it covers, so that a bit
+            // set concurrently either lands in a word we're yet to drain,
+            // or finds its word empty and sets the summary bit again.
+            var summary = AtomicUInt.exchange(_summary + i, 0, order: .acquire)
+            while summary != 0 {
+                let word = i &* UInt.bitWidth &+ summary.trailingZeroBitCount
+                summary &= summary &- 1
+                var bits = AtomicUInt.exchange(_words + word, 0, order: .acquire)
+                while bits != 0 {
+                    body(word &* UInt.bitWidth &+ bits.trailingZeroBitCount)
+                    bits &= bits &- 1
+                }
+            }
+        }
+    }
+
+    @inlinable
+    @inline(__always)
+    static func _locate(_ index: Int) -> (word: Int, mask: UInt) {
+        let (word, bit) = index.quotientAndRemainder(dividingBy: UInt.bitWidth)
+        return (word, 1 << UInt(bit))
+    }
+}
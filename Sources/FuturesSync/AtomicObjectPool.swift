@@ -0,0 +1,218 @@
+//
+//  AtomicObjectPool.swift
+//  Futures
+//
+//  Copyright © 2019 Akis Kesoglou. Licensed under the MIT license.
+//
+
+// Based on the magazine layer described in "Magazines and Vmem: Extending
+// the Slab Allocator to Many CPUs and Arbitrary Resources" by Bonwick and
+// Adams: https://www.usenix.org/legacy/event/usenix01/bonwick.html
+
+/// A pool of reusable objects that can be shared by multiple threads.
+///
+/// Objects may be taken out of the pool on one thread and returned to it on
+/// another. Each thread caches up to two *magazines* (i.e. batches) of
+/// objects locally, so most operations complete without synchronization.
+/// When a thread runs out of objects, it takes a full magazine from a global
+/// *depot*; when it accumulates too many, it returns a full magazine to the
+/// depot. The depot is a lock-free stack protected from the ABA problem via
+/// `AtomicTaggedPointer`.
+///
+/// The pool retains at most `maxRetained` objects in the depot, plus up to
+/// `2 * magazineSize` objects per thread that uses the pool; objects
+/// returned to a full pool are released. Objects are handed out as they
+/// were returned, so any state they carry must be reset by the caller.
+///
+/// When the pool is deallocated, each thread releases the objects it caches
+/// for the pool the next time it uses any pool, or when it exits. Pools are
+/// therefore best kept for the lifetime of the process.
+public final class AtomicObjectPool<T: AnyObject> {
+    @usableFromInline typealias _MagazinePointer = UnsafeMutablePointer<_Magazine>
+
+    @usableFromInline let _id: UInt
+    @usableFromInline let _factory: () -> T
+    @usableFromInline let _magazineSize: Int
+    @usableFromInline let _maxMagazines: Int
+
+    @usableFromInline let _full = AtomicTaggedPointer<_Magazine>()
+    @usableFromInline let _empty = AtomicTaggedPointer<_Magazine>()
+    @usableFromInline var _magazineCount: AtomicInt.RawValue = 0
+
+    @usableFromInline let _hits = StripedCounter()
+    @usableFromInline let _misses = StripedCounter()
+
+    /// Creates a pool.
+    ///
+    /// - Parameters:
+    ///     - maxRetained: The maximum number of objects kept in the global
+    ///         depot.
+    ///     - magazineSize: The number of objects moved between the depot and
+    ///         threads at once.
+    ///     - factory: Invoked to create an object when there are no objects
+    ///         available for reuse.
+    public init(maxRetained: Int = 1024, magazineSize: Int = 32, factory: @escaping () -> T) {
+        precondition(magazineSize > 0, "magazineSize must be greater than zero")
+        _id = _nextPoolID.fetchAdd(1, order: .relaxed)
+        _factory = factory
+        _magazineSize = magazineSize
+        _maxMagazines = max(0, maxRetained / magazineSize)
+        AtomicInt.initialize(&_magazineCount, to: 0)
+    }
+
+    deinit {
+        while let magazine = _pop(_full) {
+            magazine.pointee.objects.deinitialize(count: magazine.pointee.count)
+            _deallocate(magazine)
+        }
+        while let magazine = _pop(_empty) {
+            _deallocate(magazine)
+        }
+        _ThreadCaches.ownerDidDeinit()
+    }
+
+    /// The number of times an object was reused.
+    public var hits: Int {
+        return _hits.sum
+    }
+
+    /// The number of times an object had to be created.
+    public var misses: Int {
+        return _misses.sum
+    }
+
+    /// Takes an object out of the pool, creating a new one if there are no
+    /// objects available for reuse.
+    public func get() -> T {
+        let cache = _localCache()
+        if let obj = cache.loaded.popLast() {
+            _hits.increment()
+            return obj
+        }
+        if !cache.previous.isEmpty {
+            swap(&cache.loaded, &cache.previous)
+            _hits.increment()
+            // swiftlint:disable:next force_unwrapping
+            return cache.loaded.popLast()!
+        }
+        if let magazine = _pop(_full) {
+            let count = magazine.pointee.count
+            cache.loaded.append(contentsOf: UnsafeBufferPointer(start: magazine.pointee.objects, count: count))
+            magazine.pointee.objects.deinitialize(count: count)
+            magazine.pointee.count = 0
+            _push(_empty, magazine)
+            _hits.increment()
+            // swiftlint:disable:next force_unwrapping
+            return cache.loaded.popLast()!
+        }
+        _misses.increment()
+        return _factory()
+    }
+
+    /// Returns an object to the pool. If the pool is full, the object is
+    /// released instead.
+    public func put(_ obj: T) {
+        let cache = _localCache()
+        if cache.loaded.count < _magazineSize {
+            cache.loaded.append(obj)
+            return
+        }
+        if cache.previous.isEmpty {
+            swap(&cache.loaded, &cache.previous)
+            cache.loaded.append(obj)
+            return
+        }
+        // Both magazines are full; move one to the depot.
+        guard let magazine = _pop(_empty) ?? _allocate() else {
+            return // the depot is full too; drop the object
+        }
+        let count = cache.previous.count
+        cache.previous.withUnsafeBufferPointer {
+            // swiftlint:disable:next force_unwrapping
+            magazine.pointee.objects.initialize(from: $0.baseAddress!, count: count)
+        }
+        magazine.pointee.count = count
+        cache.previous.removeAll(keepingCapacity: true)
+        _push(_full, magazine)
+        swap(&cache.loaded, &cache.previous)
+        cache.loaded.append(obj)
+    }
+
+    // MARK: Private
+
+    @usableFromInline
+    struct _Magazine {
+        @usableFromInline var next: AtomicUInt.RawValue
+        @usableFromInline var count: Int
+        @usableFromInline let objects: UnsafeMutablePointer<T>
+    }
+
+    @usableFromInline
+    final class _LocalCache {
+        @usableFromInline var loaded: [T]
+        @usableFromInline var previous: [T]
+
+        @inlinable
+        init(capacity: Int) {
+            loaded = []
+            previous = []
+            loaded.reserveCapacity(capacity)
+            previous.reserveCapacity(capacity)
+        }
+    }
+
+    @inline(__always)
+    private func _localCache() -> _LocalCache {
+        let caches = ThreadRuntime._caches
+        if let cache = caches.get(_id) {
+            return unsafeDowncast(cache, to: _LocalCache.self)
+        }
+        let cache = _LocalCache(capacity: _magazineSize)
+        caches.insert(cache, for: _id, owner: self)
+        return cache
+    }
+
+    private func _allocate() -> _MagazinePointer? {
+        var count = AtomicInt.load(&_magazineCount, order: .relaxed)
+        repeat {
+            if count >= _maxMagazines {
+                return nil
+            }
+        } while !AtomicInt.compareExchangeWeak(&_magazineCount, &count, count + 1, order: .relaxed)
+        let magazine = _MagazinePointer.allocate(capacity: 1)
+        magazine.initialize(to: .init(next: 0, count: 0, objects: .allocate(capacity: _magazineSize)))
+        return magazine
+    }
+
+    private func _deallocate(_ magazine: _MagazinePointer) {
+        magazine.pointee.objects.deallocate()
+        magazine.deinitialize(count: 1)
+        magazine.deallocate()
+    }
+
+    // Magazines are only deallocated when the pool is, so a thread that
+    // loses a race in `_pop` can always safely read the `next` field of a
+    // magazine another thread has popped in the meantime.
+
+    private func _push(_ stack: AtomicTaggedPointer<_Magazine>, _ magazine: _MagazinePointer) {
+        var head = stack.load(order: .relaxed)
+        repeat {
+            AtomicUInt.store(&magazine.pointee.next, UInt(bitPattern: head.pointer), order: .relaxed)
+        } while !stack.compareExchangeWeak(&head, head.successor(magazine), order: .release, loadOrder: .relaxed)
+    }
+
+    private func _pop(_ stack: AtomicTaggedPointer<_Magazine>) -> _MagazinePointer? {
+        var head = stack.load(order: .acquire)
+        while let magazine = head.pointer {
+            let next = _MagazinePointer(bitPattern: AtomicUInt.load(&magazine.pointee.next, order: .relaxed))
+            if stack.compareExchangeWeak(&head, head.successor(next), order: .acquire, loadOrder: .acquire) {
+                return magazine
+            }
+        }
+        return nil
+    }
+}
+
+// MARK: - Private -
+
+private let _nextPoolID = AtomicUInt(1)
@@ -30,6 +30,9 @@ struct _AtomicBufferSlot<T> {
     }
 }
 
+@usableFromInline let _atomicBufferPushBackoffSite = Backoff.Site("AtomicBuffer.push")
+@usableFromInline let _atomicBufferPopBackoffSite = Backoff.Site("AtomicBuffer.pop")
+
 // This is an implementation of "bounded MPMC queue" from 1024cores.net.
 @usableFromInline
 final class _AtomicBuffer<T>: ManagedBuffer<_AtomicBufferHead, _AtomicBufferSlot<T>> {
@@ -88,12 +91,13 @@ extension _AtomicBuffer {
     @_transparent
     func _tryPushConcurrent(_ element: T) -> Bool {
         return withUnsafeMutablePointers { header, buffer in
-            var backoff = Backoff()
+            var backoff = Backoff(site: _atomicBufferPushBackoffSite)
             while true {
                 let head = AtomicUInt.load(&header.pointee.head, order: .relaxed)
                 let index = Int(bitPattern: head % header.pointee.capacity)
                 let next = AtomicUInt.load(&buffer[index].sequence, order: .acquire)
                 if head > next {
+                    backoff.finish()
                     return false // full
                 }
                 if head == next,
@@ -101,6 +105,7 @@ extension _AtomicBuffer {
                     assert(buffer[index].element == nil, "expected nil at index \(index), found item")
                     buffer[index].element = element
                     AtomicUInt.store(&buffer[index].sequence, head &+ 1, order: .release)
+                    backoff.finish()
                     return true
                 }
                 // FIXME: return if we exhausted our budget
@@ -133,12 +138,13 @@ extension _AtomicBuffer {
     @_transparent
     func _popConcurrent() -> T? {
         return withUnsafeMutablePointers { header, buffer in
-            var backoff = Backoff()
+            var backoff = Backoff(site: _atomicBufferPopBackoffSite)
             while true {
                 let tail = AtomicUInt.load(&header.pointee.tail, order: .relaxed)
                 let index = Int(bitPattern: tail % header.pointee.capacity)
                 let next = AtomicUInt.load(&buffer[index].sequence, order: .acquire)
                 if tail &+ 1 > next {
+                    backoff.finish()
                     return nil // empty
                 }
                 if tail &+ 1 == next,
@@ -147,6 +153,7 @@ extension _AtomicBuffer {
                     assert(item != nil, "expected item at index \(index), found nil")
                     buffer[index].element = nil
                     AtomicUInt.store(&buffer[index].sequence, tail &+ header.pointee.capacity, order: .release)
+                    backoff.finish()
                     return item
                 }
                 // FIXME: return if we exhausted our budget
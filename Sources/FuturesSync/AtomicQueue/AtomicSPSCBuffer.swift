@@ -0,0 +1,186 @@
+//
+//  AtomicSPSCBuffer.swift
+//  Futures
+//
+//  Copyright © 2019 Akis Kesoglou. Licensed under the MIT license.
+//
+
+import FuturesPrivate
+
+// Keeps the fields on either side of it at least 128 bytes apart, so that
+// they never share a cache line, nor a pair of adjacent lines on processors
+// that prefetch them together.
+@usableFromInline
+typealias _CacheLinePadding = (
+    UInt, UInt, UInt, UInt, UInt, UInt, UInt, UInt,
+    UInt, UInt, UInt, UInt, UInt, UInt, UInt, UInt
+)
+
+@usableFromInline
+let _CACHE_LINE_PADDING: _CacheLinePadding = (
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0
+)
+
+@usableFromInline
+struct _AtomicSPSCBufferHead {
+    @usableFromInline let capacity: UInt
+    @usableFromInline let mask: UInt
+    @usableFromInline var _pad0 = _CACHE_LINE_PADDING
+
+    // producer
+    @usableFromInline var head: AtomicUInt.RawValue = 0
+    @usableFromInline var cachedTail: UInt = 0
+    @usableFromInline var _pad1 = _CACHE_LINE_PADDING
+
+    // consumer
+    @usableFromInline var tail: AtomicUInt.RawValue = 0
+    @usableFromInline var cachedHead: UInt = 0
+    @usableFromInline var _pad2 = _CACHE_LINE_PADDING
+
+    @inlinable
+    init(capacity: UInt, mask: UInt) {
+        self.capacity = capacity
+        self.mask = mask
+    }
+}
+
+// A bounded ring buffer for a single producer and a single consumer.
+//
+// Unlike `_AtomicBuffer`, slots carry no per-slot sequence number; the
+// producer and consumer only communicate via the `head` and `tail` indices,
+// which are kept on separate cache lines. Each side also keeps a private copy
+// of the other side's index and only reloads it when the buffer looks full
+// (producer) or empty (consumer), so in the common case an operation touches
+// no cache line that is written by the other side, except the slot itself.
+//
+// Indices increase monotonically and wrap around on overflow; the storage
+// is rounded up to a power of 2 so that they can be mapped to slots with a
+// mask, while `capacity` is enforced exactly.
+@usableFromInline
+final class _AtomicSPSCBuffer<T>: ManagedBuffer<_AtomicSPSCBufferHead, T> {
+    @inlinable
+    static func create(capacity: Int) -> _AtomicSPSCBuffer {
+        let capacity = Int(UInt32(capacity))
+        let slots = capacity > 1 ? 1 << (Int.bitWidth - (capacity - 1).leadingZeroBitCount) : 1
+        let buffer = create(minimumCapacity: slots) { _ in
+            .init(capacity: UInt(capacity), mask: UInt(slots - 1))
+        }
+        return unsafeDowncast(buffer, to: _AtomicSPSCBuffer.self)
+    }
+
+    @inlinable
+    deinit {
+        withUnsafeMutablePointers { header, elements in
+            var tail = AtomicUInt.load(&header.pointee.tail, order: .relaxed)
+            let head = AtomicUInt.load(&header.pointee.head, order: .relaxed)
+            while tail != head {
+                (elements + Int(bitPattern: tail & header.pointee.mask)).deinitialize(count: 1)
+                tail &+= 1
+            }
+            header.deinitialize(count: 1)
+        }
+    }
+
+    @usableFromInline
+    @_transparent
+    var _capacity: Int {
+        withUnsafeMutablePointerToHeader {
+            Int(bitPattern: $0.pointee.capacity)
+        }
+    }
+
+    /// Returns the number of free slots available to the producer, reloading
+    /// the consumer index if fewer than `wanted` appear to be available.
+    @usableFromInline
+    @_transparent
+    static func _freeSlots(_ header: UnsafeMutablePointer<_AtomicSPSCBufferHead>, head: UInt, wanted: UInt) -> UInt {
+        var free = header.pointee.capacity &- (head &- header.pointee.cachedTail)
+        if free < wanted {
+            header.pointee.cachedTail = AtomicUInt.load(&header.pointee.tail, order: .acquire)
+            free = header.pointee.capacity &- (head &- header.pointee.cachedTail)
+        }
+        return free
+    }
+
+    /// Returns the number of items available to the consumer, reloading the
+    /// producer index if fewer than `wanted` appear to be available.
+    @usableFromInline
+    @_transparent
+    static func _usedSlots(_ header: UnsafeMutablePointer<_AtomicSPSCBufferHead>, tail: UInt, wanted: UInt) -> UInt {
+        var used = header.pointee.cachedHead &- tail
+        if used < wanted {
+            header.pointee.cachedHead = AtomicUInt.load(&header.pointee.head, order: .acquire)
+            used = header.pointee.cachedHead &- tail
+        }
+        return used
+    }
+
+    @usableFromInline
+    @_transparent
+    func _tryPush(_ element: T) -> Bool {
+        return withUnsafeMutablePointers { header, elements in
+            let head = AtomicUInt.load(&header.pointee.head, order: .relaxed)
+            if _AtomicSPSCBuffer._freeSlots(header, head: head, wanted: 1) == 0 {
+                return false // full
+            }
+            (elements + Int(bitPattern: head & header.pointee.mask)).initialize(to: element)
+            AtomicUInt.store(&header.pointee.head, head &+ 1, order: .release)
+            return true
+        }
+    }
+
+    @usableFromInline
+    @_transparent
+    func _tryPush<C: Collection>(contentsOf newElements: C) -> Int where C.Element == T {
+        return withUnsafeMutablePointers { header, elements in
+            let head = AtomicUInt.load(&header.pointee.head, order: .relaxed)
+            let free = _AtomicSPSCBuffer._freeSlots(header, head: head, wanted: UInt(newElements.count))
+            var index = head
+            for element in newElements.prefix(Int(bitPattern: free)) {
+                (elements + Int(bitPattern: index & header.pointee.mask)).initialize(to: element)
+                index &+= 1
+            }
+            // Publish the whole batch at once.
+            if index != head {
+                AtomicUInt.store(&header.pointee.head, index, order: .release)
+            }
+            return Int(bitPattern: index &- head)
+        }
+    }
+
+    @usableFromInline
+    @_transparent
+    func _pop() -> T? {
+        return withUnsafeMutablePointers { header, elements in
+            let tail = AtomicUInt.load(&header.pointee.tail, order: .relaxed)
+            if _AtomicSPSCBuffer._usedSlots(header, tail: tail, wanted: 1) == 0 {
+                return nil // empty
+            }
+            let item = (elements + Int(bitPattern: tail & header.pointee.mask)).move()
+            AtomicUInt.store(&header.pointee.tail, tail &+ 1, order: .release)
+            return item
+        }
+    }
+
+    @usableFromInline
+    @_transparent
+    func _pop(upTo maxCount: Int, _ body: (T) -> Void) -> Int {
+        precondition(maxCount >= 0, "maxCount must not be negative")
+        return withUnsafeMutablePointers { header, elements in
+            let tail = AtomicUInt.load(&header.pointee.tail, order: .relaxed)
+            let used = _AtomicSPSCBuffer._usedSlots(header, tail: tail, wanted: UInt(maxCount))
+            let count = min(used, UInt(maxCount))
+            var index = tail
+            while index != tail &+ count {
+                body((elements + Int(bitPattern: index & header.pointee.mask)).move())
+                index &+= 1
+            }
+            // Release the whole batch of slots at once.
+            if count != 0 {
+                AtomicUInt.store(&header.pointee.tail, index, order: .release)
+            }
+            return Int(bitPattern: count)
+        }
+    }
+}
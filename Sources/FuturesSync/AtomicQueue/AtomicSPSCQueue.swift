@@ -9,8 +9,13 @@ import FuturesPrivate
 
 /// A bounded FIFO queue that is safe to share among a single producer and a
 /// single consumer.
+///
+/// The producer and consumer each cache the other's position in the queue
+/// and only synchronize with each other when the queue looks full or empty,
+/// respectively. Use the batched `tryPush(contentsOf:)` and `pop(upTo:_:)`
+/// to further amortize synchronization over several elements.
 public struct AtomicSPSCQueue<Element>: AtomicQueueProtocol {
-    @usableFromInline let _buffer: _AtomicBuffer<Element>
+    @usableFromInline let _buffer: _AtomicSPSCBuffer<Element>
 
     @inlinable
     public init(capacity: Int) {
@@ -27,8 +32,28 @@ public struct AtomicSPSCQueue<Element>: AtomicQueueProtocol {
         return _buffer._tryPush(element)
     }
 
+    /// Pushes as many elements from the start of `elements` as there is room
+    /// for, making them visible to the consumer at once.
+    ///
+    /// - Returns: The number of elements pushed.
+    @inlinable
+    @discardableResult
+    public func tryPush<C: Collection>(contentsOf elements: C) -> Int where C.Element == Element {
+        return _buffer._tryPush(contentsOf: elements)
+    }
+
     @inlinable
     public func pop() -> Element? {
         return _buffer._pop()
     }
+
+    /// Pops up to `maxCount` elements, invoking `body` with each in FIFO
+    /// order, and frees their slots for the producer at once.
+    ///
+    /// - Returns: The number of elements popped.
+    @inlinable
+    @discardableResult
+    public func pop(upTo maxCount: Int, _ body: (Element) -> Void) -> Int {
+        return _buffer._pop(upTo: maxCount, body)
+    }
 }
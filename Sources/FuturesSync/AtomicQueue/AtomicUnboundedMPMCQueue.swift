@@ -0,0 +1,342 @@
+//
+//  AtomicUnboundedMPMCQueue.swift
+//  Futures
+//
+//  Copyright © 2019 Akis Kesoglou. Licensed under the MIT license.
+//
+
+import FuturesPrivate
+
+/// A FIFO queue that is safe to share among multiple producers and multiple
+/// consumers.
+///
+/// Elements are stored in linked segments of 31 slots each. Producers and
+/// consumers claim slots by advancing the tail and head indices, so an
+/// operation costs one compare-and-exchange in the common case, and a new
+/// segment is only allocated every 31 pushes. Segments are freed by the
+/// last consumer that reads from them, without the need for a garbage
+/// collection scheme.
+public final class AtomicUnboundedMPMCQueue<T>: AtomicUnboundedQueueProtocol {
+    // This is a port of `SegQueue` from crossbeam:
+    // https://github.com/crossbeam-rs/crossbeam
+
+    public typealias Element = T
+
+    @usableFromInline typealias _Segment = _AtomicSegment<T>
+
+    // consumers
+    @usableFromInline var _headIndex: AtomicUInt.RawValue = 0
+    @usableFromInline var _headSegment: AtomicUInt.RawValue = 0
+    @usableFromInline var _pad = _CACHE_LINE_PADDING
+
+    // producers
+    @usableFromInline var _tailIndex: AtomicUInt.RawValue = 0
+    @usableFromInline var _tailSegment: AtomicUInt.RawValue = 0
+
+    @inlinable
+    public init() {
+        AtomicUInt.initialize(&_headIndex, to: 0)
+        AtomicUInt.initialize(&_headSegment, to: 0)
+        AtomicUInt.initialize(&_tailIndex, to: 0)
+        AtomicUInt.initialize(&_tailSegment, to: 0)
+    }
+
+    @inlinable
+    deinit {
+        var head = AtomicUInt.load(&_headIndex, order: .relaxed) & ~_SEGMENT_HAS_NEXT
+        let tail = AtomicUInt.load(&_tailIndex, order: .relaxed) & ~_SEGMENT_HAS_NEXT
+        var segment = _Segment(bits: AtomicUInt.load(&_headSegment, order: .relaxed))
+
+        // Drop all values between `head` and `tail` and free all segments.
+        while head != tail {
+            // swiftlint:disable:next force_unwrapping
+            let current = segment!
+            let offset = _Segment.offset(of: head)
+            if offset < _SEGMENT_CAPACITY {
+                current.value(offset).deinitialize(count: 1)
+            } else {
+                segment = _Segment(bits: AtomicUInt.load(current.next, order: .relaxed))
+                current.deallocate()
+            }
+            head &+= 1 << _SEGMENT_SHIFT
+        }
+        segment?.deallocate()
+    }
+
+    @inlinable
+    public var isEmpty: Bool {
+        let head = AtomicUInt.load(&_headIndex)
+        let tail = AtomicUInt.load(&_tailIndex)
+        return head >> _SEGMENT_SHIFT == tail >> _SEGMENT_SHIFT
+    }
+
+    @inlinable
+    public func push(_ value: T) {
+        var backoff = Backoff()
+        var tail = AtomicUInt.load(&_tailIndex, order: .acquire)
+        var segment = _Segment(bits: AtomicUInt.load(&_tailSegment, order: .acquire))
+        var nextSegment: _Segment?
+
+        while true {
+            let offset = _Segment.offset(of: tail)
+
+            // If we reached the end of the segment, wait until the next one
+            // is installed.
+            if offset == _SEGMENT_CAPACITY {
+                backoff.snooze()
+                tail = AtomicUInt.load(&_tailIndex, order: .acquire)
+                segment = _Segment(bits: AtomicUInt.load(&_tailSegment, order: .acquire))
+                continue
+            }
+
+            // If we're going to have to install the next segment, allocate
+            // it in advance to make the wait for other threads as short as
+            // possible.
+            if offset + 1 == _SEGMENT_CAPACITY, nextSegment == nil {
+                nextSegment = .allocate()
+            }
+
+            // If this is the first push, we need to allocate the first segment.
+            if segment == nil {
+                let new = _Segment.allocate()
+                if AtomicUInt.compareExchange(&_tailSegment, 0, new.bits, order: .release, loadOrder: .relaxed) == 0 {
+                    AtomicUInt.store(&_headSegment, new.bits, order: .release)
+                    segment = new
+                } else {
+                    nextSegment?.deallocate()
+                    nextSegment = new
+                    tail = AtomicUInt.load(&_tailIndex, order: .acquire)
+                    segment = _Segment(bits: AtomicUInt.load(&_tailSegment, order: .acquire))
+                    continue
+                }
+            }
+
+            // Try advancing the tail forward.
+            let newTail = tail &+ (1 << _SEGMENT_SHIFT)
+            if AtomicUInt.compareExchangeWeak(&_tailIndex, &tail, newTail, order: .seqcst, loadOrder: .acquire) {
+                // swiftlint:disable:next force_unwrapping
+                let current = segment!
+
+                // If we've reached the end of the segment, install the next one.
+                if offset + 1 == _SEGMENT_CAPACITY {
+                    // swiftlint:disable:next force_unwrapping
+                    let next = nextSegment.move()!
+                    AtomicUInt.store(&_tailSegment, next.bits, order: .release)
+                    AtomicUInt.store(&_tailIndex, newTail &+ (1 << _SEGMENT_SHIFT), order: .release)
+                    AtomicUInt.store(current.next, next.bits, order: .release)
+                }
+
+                current.value(offset).initialize(to: value)
+                AtomicUInt.fetchOr(current.state(offset), _SLOT_WRITE, order: .release)
+
+                nextSegment?.deallocate()
+                return
+            }
+
+            segment = _Segment(bits: AtomicUInt.load(&_tailSegment, order: .acquire))
+            backoff.snooze()
+        }
+    }
+
+    @inlinable
+    public func pop() -> T? {
+        var backoff = Backoff()
+        var head = AtomicUInt.load(&_headIndex, order: .acquire)
+        var segment = _Segment(bits: AtomicUInt.load(&_headSegment, order: .acquire))
+
+        while true {
+            let offset = _Segment.offset(of: head)
+
+            // If we reached the end of the segment, wait until the next one
+            // is installed.
+            if offset == _SEGMENT_CAPACITY {
+                backoff.snooze()
+                head = AtomicUInt.load(&_headIndex, order: .acquire)
+                segment = _Segment(bits: AtomicUInt.load(&_headSegment, order: .acquire))
+                continue
+            }
+
+            var newHead = head &+ (1 << _SEGMENT_SHIFT)
+
+            if newHead & _SEGMENT_HAS_NEXT == 0 {
+                Atomic.threadFence()
+                let tail = AtomicUInt.load(&_tailIndex, order: .relaxed)
+
+                // If the tail equals the head, the queue is empty.
+                if head >> _SEGMENT_SHIFT == tail >> _SEGMENT_SHIFT {
+                    return nil
+                }
+
+                // If head and tail are not in the same segment, mark that
+                // there is a next segment, so that we can skip checking
+                // the tail until we reach it.
+                if (head >> _SEGMENT_SHIFT) / _SEGMENT_LAP != (tail >> _SEGMENT_SHIFT) / _SEGMENT_LAP {
+                    newHead |= _SEGMENT_HAS_NEXT
+                }
+            }
+
+            // The segment can only be nil here if the first push is in
+            // progress; wait until it is installed.
+            guard let current = segment else {
+                backoff.snooze()
+                head = AtomicUInt.load(&_headIndex, order: .acquire)
+                segment = _Segment(bits: AtomicUInt.load(&_headSegment, order: .acquire))
+                continue
+            }
+
+            // Try moving the head forward.
+            if AtomicUInt.compareExchangeWeak(&_headIndex, &head, newHead, order: .seqcst, loadOrder: .acquire) {
+                // If we've reached the end of the segment, move to the next one.
+                if offset + 1 == _SEGMENT_CAPACITY {
+                    let next = current.waitNext()
+                    var nextIndex = (newHead & ~_SEGMENT_HAS_NEXT) &+ (1 << _SEGMENT_SHIFT)
+                    if AtomicUInt.load(next.next, order: .relaxed) != 0 {
+                        nextIndex |= _SEGMENT_HAS_NEXT
+                    }
+                    AtomicUInt.store(&_headSegment, next.bits, order: .release)
+                    AtomicUInt.store(&_headIndex, nextIndex, order: .release)
+                }
+
+                current.waitWrite(offset)
+                let value = current.value(offset).move()
+
+                // Free the segment if we've reached its end, or if another
+                // thread wanted to but couldn't because we were still
+                // reading from the slot.
+                if offset + 1 == _SEGMENT_CAPACITY {
+                    _Segment.destroy(current, from: 0)
+                } else if AtomicUInt.fetchOr(current.state(offset), _SLOT_READ, order: .acqrel) & _SLOT_DESTROY != 0 {
+                    _Segment.destroy(current, from: offset + 1)
+                }
+                return value
+            }
+
+            segment = _Segment(bits: AtomicUInt.load(&_headSegment, order: .acquire))
+            backoff.snooze()
+        }
+    }
+}
+
+// MARK: - Private -
+
+// Each segment spans a "lap" of indices, the last of which doesn't map to a
+// slot; it marks that the next segment is being installed.
+@usableFromInline let _SEGMENT_LAP: UInt = 32
+@usableFromInline let _SEGMENT_CAPACITY = Int(_SEGMENT_LAP) - 1
+
+// Indices are shifted by one bit; the lowest bit of the head index is set
+// when it is known that there is a segment after the head's.
+@usableFromInline let _SEGMENT_SHIFT: UInt = 1
+@usableFromInline let _SEGMENT_HAS_NEXT: UInt = 1
+
+// Slot states.
+@usableFromInline let _SLOT_WRITE: UInt = 1 // a value has been written into the slot
+@usableFromInline let _SLOT_READ: UInt = 2 // the value has been read from the slot
+@usableFromInline let _SLOT_DESTROY: UInt = 4 // the segment is to be freed by the reader of the slot
+
+/// A handle to a segment of an `AtomicUnboundedMPMCQueue`, allocated as a
+/// single block of memory: the pointer to the next segment, followed by
+/// the slot states and then the slot values.
+@usableFromInline
+struct _AtomicSegment<T> {
+    @usableFromInline let _ptr: UnsafeMutableRawPointer
+
+    @inlinable
+    init(_ ptr: UnsafeMutableRawPointer) {
+        _ptr = ptr
+    }
+
+    @inlinable
+    init?(bits: UInt) {
+        guard let ptr = UnsafeMutableRawPointer(bitPattern: bits) else {
+            return nil
+        }
+        _ptr = ptr
+    }
+
+    @inlinable
+    static var _valuesOffset: Int {
+        let offset = MemoryLayout<AtomicUInt.RawValue>.stride * (1 + _SEGMENT_CAPACITY)
+        let alignment = MemoryLayout<T>.alignment
+        return (offset + alignment - 1) & ~(alignment - 1)
+    }
+
+    @inlinable
+    static func allocate() -> _AtomicSegment {
+        let ptr = UnsafeMutableRawPointer.allocate(
+            byteCount: _valuesOffset + MemoryLayout<T>.stride * _SEGMENT_CAPACITY,
+            alignment: max(MemoryLayout<AtomicUInt.RawValue>.alignment, MemoryLayout<T>.alignment)
+        )
+        ptr.initializeMemory(as: AtomicUInt.RawValue.self, repeating: 0, count: 1 + _SEGMENT_CAPACITY)
+        (ptr + _valuesOffset).bindMemory(to: T.self, capacity: _SEGMENT_CAPACITY)
+        return _AtomicSegment(ptr)
+    }
+
+    @inlinable
+    func deallocate() {
+        _ptr.deallocate()
+    }
+
+    @inlinable
+    static func offset(of index: UInt) -> Int {
+        return Int(bitPattern: (index >> _SEGMENT_SHIFT) % _SEGMENT_LAP)
+    }
+
+    @inlinable
+    var bits: UInt {
+        return UInt(bitPattern: _ptr)
+    }
+
+    @inlinable
+    var next: AtomicUInt.Pointer {
+        return _ptr.assumingMemoryBound(to: AtomicUInt.RawValue.self)
+    }
+
+    @inlinable
+    func state(_ offset: Int) -> AtomicUInt.Pointer {
+        return next + 1 + offset
+    }
+
+    @inlinable
+    func value(_ offset: Int) -> UnsafeMutablePointer<T> {
+        return (_ptr + _AtomicSegment._valuesOffset).assumingMemoryBound(to: T.self) + offset
+    }
+
+    /// Waits until the next segment is installed.
+    @inlinable
+    func waitNext() -> _AtomicSegment {
+        var backoff = Backoff()
+        while true {
+            if let next = _AtomicSegment(bits: AtomicUInt.load(self.next, order: .acquire)) {
+                return next
+            }
+            backoff.snooze()
+        }
+    }
+
+    /// Waits until a value is written into the slot at `offset`.
+    @inlinable
+    func waitWrite(_ offset: Int) {
+        var backoff = Backoff()
+        while AtomicUInt.load(state(offset), order: .acquire) & _SLOT_WRITE == 0 {
+            backoff.snooze()
+        }
+    }
+
+    /// Frees `segment`, unless a consumer is still reading from one of its
+    /// slots starting at `start`; that consumer is then responsible for
+    /// continuing the destruction once it is done.
+    @inlinable
+    static func destroy(_ segment: _AtomicSegment, from start: Int) {
+        // It's not necessary to mark the last slot, because the consumer
+        // that reads from it begins destruction of the segment.
+        for offset in start..<(_SEGMENT_CAPACITY - 1) {
+            let state = segment.state(offset)
+            if AtomicUInt.load(state, order: .acquire) & _SLOT_READ == 0,
+               AtomicUInt.fetchOr(state, _SLOT_DESTROY, order: .acqrel) & _SLOT_READ == 0 {
+                return
+            }
+        }
+        segment.deallocate()
+    }
+}
@@ -7,9 +7,22 @@
 
 // Ported over from crossbeam: https://github.com/crossbeam-rs/crossbeam
 
+import FuturesPrivate
+
 @usableFromInline let _MAX_SPINS: UInt = 6 // 2^6 = 64
 @usableFromInline let _MAX_YIELDS: UInt = 10 // 2^10 = 1024
 
+// The upper bound for spin limits learned by `Backoff.Site`.
+@usableFromInline let _MAX_ADAPTIVE_SPINS: UInt = 10 // 2^10 = 1024
+
+// One in this many finished loops on each thread adapts the spin limit of
+// its `Backoff.Site`. Must be a power of 2.
+@usableFromInline let _BACKOFF_ADAPT_INTERVAL: UInt32 = 8
+
+// The longest a thread parks for in `Backoff.snooze(parkingOn:validate:)`,
+// in nanoseconds, before it re-checks the condition it waits on.
+let _MAX_PARK_NANOSECONDS = 1_000_000
+
 /// Helper for implementing spin loops.
 ///
 /// An example of a busy-wait loop. The current thread will efficiently spin,
@@ -50,34 +63,218 @@
 ///     assert(a.fetchMul(by: 7) == 6)
 ///     assert(a.load() == 42)
 ///
+/// By default, `Backoff` spins for a fixed number of steps and then yields
+/// the processor a fixed number of times. Loops that are executed often can
+/// instead create a backoff from a `Backoff.Site`, which learns how long it
+/// is worth spinning for from the outcome of previous waits, and records how
+/// often each tier of backoff is reached:
+///
+///     let site = Backoff.Site("MyQueue.push")
+///
+///     var backoff = Backoff(site: site)
+///     while !tryPush(item) {
+///         backoff.snooze()
+///     }
+///     backoff.finish()
+///
 public struct Backoff {
     @usableFromInline var _step: UInt = 0
+    @usableFromInline var _spinLimit: UInt
+    @usableFromInline unowned(unsafe) let _site: Site?
 
     @inlinable
-    public init() {}
+    public init() {
+        _spinLimit = _MAX_SPINS
+        _site = nil
+    }
+
+    /// Creates a backoff that spins for as long as `site` has learned is
+    /// worthwhile, and reports to it when the loop is finished.
+    ///
+    /// The site is not retained and is only read once the loop first
+    /// snoozes, so that creating a backoff costs nothing for loops that
+    /// never wait. The site must outlive the backoff.
+    @inlinable
+    public init(site: Site) {
+        _spinLimit = 0
+        _site = site
+    }
+
+    @inlinable
+    var _yieldLimit: UInt {
+        _spinLimit + (_MAX_YIELDS - _MAX_SPINS)
+    }
 
     /// A boolean denoting whether backoff completed and it is no longer
     /// useful to spin, indicating contention.
     ///
     /// If `isComplete` is `true`, the caller should arrange for getting
     /// notified when the condition the loop waits on is satisfied and park
-    /// the current thread.
+    /// the current thread; see `snooze(parkingOn:validate:)`.
     @inlinable
     public var isComplete: Bool {
-        _step > _MAX_YIELDS
+        _step > _yieldLimit
+    }
+
+    /// Whether the next call to `snooze()` spins rather than yields.
+    @inlinable
+    var _isSpinning: Bool {
+        _step <= _spinLimit
     }
 
     @inlinable
     public mutating func snooze() {
-        if _step <= _MAX_SPINS {
+        if _step == 0, let site = _site {
+            _spinLimit = site.spinLimit
+            site._spins.increment()
+        }
+        if _step <= _spinLimit {
             for _ in 0..<(1 << _step) {
                 Atomic.hardwarePause()
             }
         } else {
+            if _step == _spinLimit + 1 {
+                _site?._yields.increment()
+            }
             Atomic.preemptionYield(UInt64(_step))
         }
-        if _step <= _MAX_YIELDS {
+        if _step <= _yieldLimit {
             _step += 1
         }
     }
+
+    /// Backs off like `snooze()` until backoff is complete and then parks
+    /// the current thread on `address`, via `ParkingLot`.
+    ///
+    /// `validate` is invoked while holding the parking lot's queue lock and
+    /// should return `true` if the condition the loop waits on is still not
+    /// satisfied. The thread that satisfies the condition should then call
+    /// `ParkingLot.unparkAll(address:)` to wake up parked threads.
+    ///
+    /// Threads park for a bounded amount of time, so a missed or omitted
+    /// wake-up only adds latency; the caller must re-check its condition
+    /// after each call.
+    public mutating func snooze(parkingOn address: UnsafeRawPointer, validate: () -> Bool) {
+        guard isComplete else {
+            snooze()
+            return
+        }
+        let result = ParkingLot.park(
+            address: address,
+            validate: validate,
+            deadline: _deadline(afterNanoseconds: _MAX_PARK_NANOSECONDS)
+        )
+        if result != .invalid {
+            _site?._parks.increment()
+        }
+    }
+
+    /// Reports to the site the backoff was created with, if any, that the
+    /// loop is finished, allowing it to adapt its spin limit to the number
+    /// of times the loop snoozed.
+    ///
+    /// Only a sample of finished loops is reported, so that threads looping
+    /// on the same site don't all write to it every time.
+    @inlinable
+    public func finish() {
+        if _step > 0, let site = _site, Backoff._sampleFinish() {
+            site._adapt(step: _step, spinLimit: _spinLimit)
+        }
+    }
+
+    /// Returns `true` for one in `_BACKOFF_ADAPT_INTERVAL` calls on each
+    /// thread.
+    @inlinable
+    @inline(__always)
+    static func _sampleFinish() -> Bool {
+        let runtime = CThreadRuntimeGetCurrent()
+        let count = runtime.pointee.backoffFinishes &+ 1
+        runtime.pointee.backoffFinishes = count
+        return count & (_BACKOFF_ADAPT_INTERVAL - 1) == 0
+    }
+}
+
+extension Backoff {
+    /// Shared, adaptive state for the backoffs created at a given call site.
+    ///
+    /// A site maintains a moving average of how long spinning had to go on
+    /// for before the loops that used it finished. If loops regularly finish
+    /// while spinning, or right after the first yield, the spin limit grows;
+    /// if they regularly go on to yield or park, spinning is wasted and the
+    /// spin limit shrinks. On uniprocessor systems, where spinning is never
+    /// useful, the spin limit is always zero; loops then spin for a single
+    /// iteration before they start yielding.
+    ///
+    /// Sites are meant to be long-lived, typically global constants shared
+    /// by all instances of a type. Backoffs only touch their site once they
+    /// have to wait, and only a sample of finished loops updates the spin
+    /// limit, so uncontended loops cost nothing and contended ones rarely
+    /// write to the site.
+    public final class Site {
+        /// A label identifying the site.
+        public let label: String
+
+        // The spin limit in fixed-point, with 4 fractional bits. Updates
+        // are racy; losing one every now and then is inconsequential.
+        @usableFromInline var _limit: AtomicUInt.RawValue = 0
+        @usableFromInline let _minLimit: UInt
+        @usableFromInline let _maxLimit: UInt
+
+        @usableFromInline let _spins = StripedCounter()
+        @usableFromInline let _yields = StripedCounter()
+        @usableFromInline let _parks = StripedCounter()
+
+        public init(_ label: String) {
+            self.label = label
+            let maxLimit = _CPU_COUNT > 1 ? _MAX_ADAPTIVE_SPINS : 0
+            _maxLimit = maxLimit
+            _minLimit = min(1, maxLimit)
+            AtomicUInt.initialize(&_limit, to: min(_MAX_SPINS, maxLimit) << 4)
+        }
+
+        /// The number of spin steps backoffs created from this site take
+        /// before they start yielding. Step `n` spins for `2^n` iterations.
+        @inlinable
+        public var spinLimit: UInt {
+            AtomicUInt.load(&_limit, order: .relaxed) >> 4
+        }
+
+        /// Counts of how often each tier of backoff was reached.
+        public struct Statistics: Equatable {
+            /// The number of loops that had to spin at least once.
+            public var spins: Int
+
+            /// The number of loops that went on to yield the processor.
+            public var yields: Int
+
+            /// The number of times a thread parked.
+            public var parks: Int
+        }
+
+        /// The statistics gathered since the site was created or last reset.
+        public var statistics: Statistics {
+            Statistics(spins: _spins.sum, yields: _yields.sum, parks: _parks.sum)
+        }
+
+        /// Resets statistics and returns their previous values.
+        @discardableResult
+        public func resetStatistics() -> Statistics {
+            Statistics(spins: _spins.reset(), yields: _yields.reset(), parks: _parks.reset())
+        }
+
+        @usableFromInline
+        func _adapt(step: UInt, spinLimit: UInt) {
+            // `step` is the number of times the loop snoozed. Finishing
+            // within the spin phase, or right after the first yield, means
+            // spinning up to `step` would have sufficed; anything longer
+            // means spinning was of no use.
+            let observed = step <= spinLimit + 2 ? min(step, _maxLimit) : _minLimit
+            let current = AtomicUInt.load(&_limit, order: .relaxed)
+            var next = current &- (current >> 3) &+ (observed << 1)
+            next = max(_minLimit << 4, min(next, _maxLimit << 4))
+            if next != current {
+                AtomicUInt.store(&_limit, next, order: .relaxed)
+            }
+        }
+    }
 }
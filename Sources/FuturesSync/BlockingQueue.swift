@@ -0,0 +1,126 @@
+//
+//  BlockingQueue.swift
+//  Futures
+//
+//  Copyright © 2019 Akis Kesoglou. Licensed under the MIT license.
+//
+
+#if canImport(Darwin)
+import Darwin.POSIX.pthread
+#else
+import Glibc
+#endif
+
+@usableFromInline let _blockingQueuePopBackoffSite = Backoff.Site("BlockingQueue.pop")
+
+/// An unbounded FIFO queue that is safe to share among multiple producers
+/// and multiple consumers, whose consumers can block waiting for elements.
+///
+/// Elements are stored in an `AtomicUnboundedMPMCQueue`. Consumers that
+/// find the queue empty spin briefly and then block on an `EventCount`,
+/// until a producer pushes an element or their timeout expires. Producers
+/// only notify the event count when there are consumers waiting, so pushing
+/// is lock-free while consumers are busy.
+public final class BlockingQueue<T>: AtomicUnboundedQueueProtocol {
+    public typealias Element = T
+
+    @usableFromInline let _queue = AtomicUnboundedMPMCQueue<T>()
+    @usableFromInline let _event = EventCount()
+
+    @inlinable
+    public init() {}
+
+    /// A Boolean value indicating whether the queue is empty.
+    @inlinable
+    public var isEmpty: Bool {
+        return _queue.isEmpty
+    }
+
+    /// Pushes `element` to the queue, waking up a waiting consumer if any.
+    @inlinable
+    public func push(_ element: T) {
+        _queue.push(element)
+        _event.notifyOne()
+    }
+
+    /// Pops an element from the queue, without waiting, or returns `nil`
+    /// if the queue is empty.
+    @inlinable
+    public func pop() -> T? {
+        return _queue.pop()
+    }
+
+    /// Pops an element from the queue, waiting up to `timeout` for one to
+    /// be pushed if the queue is empty.
+    ///
+    /// - Parameter timeout: The maximum time to wait, in nanoseconds. Pass
+    ///     `nil` to wait indefinitely, or `0` to not wait at all.
+    /// - Returns: The element popped, or `nil` if the timeout expired.
+    @inlinable
+    public func pop(timeout nanoseconds: Int?) -> T? {
+        if let element = _queue.pop() {
+            return element
+        }
+        if nanoseconds == 0 {
+            return nil
+        }
+        return _popSlow(timeout: nanoseconds)
+    }
+
+    /// Pops up to `maxCount` elements from the queue, waiting up to
+    /// `timeout` for the first one if the queue is empty.
+    ///
+    /// This is useful for consumers that want to amortize the cost of
+    /// waking up over several elements.
+    ///
+    /// - Parameters:
+    ///     - maxCount: The maximum number of elements to pop.
+    ///     - timeout: The maximum time to wait for the first element, in
+    ///       nanoseconds. Pass `nil` to wait indefinitely. Defaults to `0`;
+    ///       that is, to not wait at all.
+    /// - Returns: The elements popped, in FIFO order. The array is empty if
+    ///     the timeout expired.
+    @inlinable
+    public func drain(max maxCount: Int, timeout nanoseconds: Int? = 0) -> [T] {
+        precondition(maxCount >= 0, "maxCount must not be negative")
+        guard maxCount > 0, let first = pop(timeout: nanoseconds) else {
+            return []
+        }
+        var elements = [first]
+        while elements.count < maxCount, let element = _queue.pop() {
+            elements.append(element)
+        }
+        return elements
+    }
+
+    @usableFromInline
+    func _popSlow(timeout nanoseconds: Int?) -> T? {
+        // Spin a little first; the queue may become non-empty soon.
+        var backoff = Backoff(site: _blockingQueuePopBackoffSite)
+        while !backoff.isComplete {
+            backoff.snooze()
+            if let element = _queue.pop() {
+                backoff.finish()
+                return element
+            }
+        }
+        backoff.finish()
+
+        let deadline = nanoseconds.map(_deadline(afterNanoseconds:))
+        while true {
+            let key = _event.prepareWait()
+            if let element = _queue.pop() {
+                _event.cancelWait()
+                return element
+            }
+            let notified = _event.commitWait(key, deadline: deadline)
+            if let element = _queue.pop() {
+                return element
+            }
+            if !notified {
+                return nil
+            }
+            // Another consumer got to the element first; wait again.
+        }
+    }
+}
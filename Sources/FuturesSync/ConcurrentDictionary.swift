@@ -0,0 +1,212 @@
+//
+//  ConcurrentDictionary.swift
+//  Futures
+//
+//  Copyright © 2019 Akis Kesoglou. Licensed under the MIT license.
+//
+
+// The alignment of each shard. Larger than a typical cache line, to also
+// keep shards apart on processors that prefetch adjacent lines in pairs.
+@usableFromInline let _CONCURRENT_DICTIONARY_SHARD_ALIGNMENT = 128
+
+/// A hash map that can be safely accessed from multiple threads.
+///
+/// The map is split into a fixed, power-of-two number of shards, each of
+/// which is a regular `Dictionary` protected by its own `RawMutex`. A key
+/// is assigned to a shard based on its hash value, so operations on keys
+/// that belong to different shards never contend with each other.
+///
+/// Each shard is kept on its own cache lines, so that traffic on the lock
+/// of one shard does not slow down operations on its neighbours.
+///
+/// Shards grow independently as they fill up, so the map is never resized
+/// as a whole. A shard that grows rehashes all of its entries at once,
+/// while holding its lock; rather than resizing incrementally, the map
+/// bounds the cost of each resize to a single shard, which only blocks
+/// operations on keys that belong to it while the rest of the map remains
+/// available.
+///
+/// Operations that span the whole map, such as `count` or `forEach(_:)`,
+/// visit the shards one at a time and do not observe an atomic snapshot.
+public final class ConcurrentDictionary<Key: Hashable, Value> {
+    @usableFromInline let _shards: UnsafeMutableRawPointer
+    @usableFromInline let _shardCount: Int
+    @usableFromInline let _shardStride: Int
+    @usableFromInline let _shift: UInt
+
+    /// Creates an empty map.
+    ///
+    /// - Parameter shardCount: The number of shards to split the map into.
+    ///     Must be a power of 2. More shards reduce contention at the cost
+    ///     of a larger memory footprint.
+    public init(shardCount: Int = 64) {
+        precondition(shardCount > 0 && isPowerOf2(shardCount), "shardCount must be a power of 2")
+        let alignment = _CONCURRENT_DICTIONARY_SHARD_ALIGNMENT
+        _shardStride = (MemoryLayout<_Shard>.stride + alignment - 1) / alignment * alignment
+        _shardCount = shardCount
+        _shards = .allocate(byteCount: shardCount * _shardStride, alignment: alignment)
+        for i in 0..<shardCount {
+            let shard = (_shards + i * _shardStride).bindMemory(to: _Shard.self, capacity: 1)
+            shard.initialize(to: _Shard())
+            RawMutex.initialize(&shard.pointee.lock)
+        }
+        _shift = UInt(UInt.bitWidth - shardCount.trailingZeroBitCount)
+    }
+
+    deinit {
+        for i in 0..<_shardCount {
+            _shard(at: i).deinitialize(count: 1)
+        }
+        _shards.deallocate()
+    }
+
+    /// Returns the value associated with `key`, if any.
+    @inlinable
+    public func value(forKey key: Key) -> Value? {
+        return _withShard(for: key) {
+            $0[key]
+        }
+    }
+
+    @inlinable
+    public subscript(key: Key) -> Value? {
+        get {
+            return value(forKey: key)
+        }
+        set {
+            if let value = newValue {
+                updateValue(value, forKey: key)
+            } else {
+                removeValue(forKey: key)
+            }
+        }
+    }
+
+    /// Updates the value associated with `key`, or adds a new key-value
+    /// pair if `key` does not exist.
+    ///
+    /// - Returns: The value that was replaced, or `nil` if a new key-value
+    ///     pair was added.
+    @inlinable
+    @discardableResult
+    public func updateValue(_ value: Value, forKey key: Key) -> Value? {
+        return _withShard(for: key) {
+            $0.updateValue(value, forKey: key)
+        }
+    }
+
+    /// Adds a new key-value pair only if `key` does not exist.
+    ///
+    /// - Returns: `true` if the pair was added; otherwise, `false`.
+    @inlinable
+    @discardableResult
+    public func insertValue(_ value: Value, forKey key: Key) -> Bool {
+        return compute(key) {
+            if $0 == nil {
+                $0 = value
+                return true
+            }
+            return false
+        }
+    }
+
+    /// Removes `key` and its associated value from the map.
+    ///
+    /// - Returns: The value that was removed, or `nil` if `key` did not exist.
+    @inlinable
+    @discardableResult
+    public func removeValue(forKey key: Key) -> Value? {
+        return _withShard(for: key) {
+            $0.removeValue(forKey: key)
+        }
+    }
+
+    /// Atomically reads and updates the value associated with `key`.
+    ///
+    /// `fn` is passed the current value, or `nil` if `key` does not exist,
+    /// and can modify it in place; setting it to `nil` removes `key` from
+    /// the map. `fn` is invoked while holding the lock of the shard `key`
+    /// belongs to, so it must be short and must not access the map.
+    @inlinable
+    @discardableResult
+    public func compute<R>(_ key: Key, _ fn: (inout Value?) throws -> R) rethrows -> R {
+        return try _withShard(for: key) {
+            try fn(&$0[key])
+        }
+    }
+
+    /// The number of key-value pairs in the map.
+    public var count: Int {
+        return (0..<_shardCount).reduce(0) { count, index in
+            count + _withShard(at: index) { $0.count }
+        }
+    }
+
+    /// A Boolean value indicating whether the map is empty.
+    public var isEmpty: Bool {
+        return (0..<_shardCount).allSatisfy { index in
+            _withShard(at: index) { $0.isEmpty }
+        }
+    }
+
+    /// Removes all key-value pairs from the map.
+    public func removeAll() {
+        for index in 0..<_shardCount {
+            _withShard(at: index) { $0.removeAll() }
+        }
+    }
+
+    /// Invokes `fn` for every key-value pair in the map. `fn` is invoked
+    /// while holding the lock of the shard the pair belongs to, so it must
+    /// not access the map.
+    public func forEach(_ fn: (Key, Value) throws -> Void) rethrows {
+        for index in 0..<_shardCount {
+            try _withShard(at: index) {
+                for (key, value) in $0 {
+                    try fn(key, value)
+                }
+            }
+        }
+    }
+
+    /// Returns a copy of the map's contents.
+    public func dictionary() -> [Key: Value] {
+        var result = [Key: Value]()
+        forEach { result[$0] = $1 }
+        return result
+    }
+
+    @inlinable
+    @inline(__always)
+    func _withShard<R>(for key: Key, _ fn: (inout [Key: Value]) throws -> R) rethrows -> R {
+        // Fibonacci hashing; use the high bits so that the shard index is
+        // uncorrelated to the bucket the key lands in within the shard.
+        let hash = UInt(bitPattern: key.hashValue) &* UInt(truncatingIfNeeded: 0x9E37_79B9_7F4A_7C15 as UInt64)
+        let index = _shift == UInt(UInt.bitWidth) ? 0 : Int(bitPattern: hash >> _shift)
+        return try _withShard(at: index, fn)
+    }
+
+    @inlinable
+    @inline(__always)
+    func _withShard<R>(at index: Int, _ fn: (inout [Key: Value]) throws -> R) rethrows -> R {
+        let shard = _shard(at: index)
+        RawMutex.acquire(&shard.pointee.lock)
+        defer { RawMutex.release(&shard.pointee.lock) }
+        return try fn(&shard.pointee.storage)
+    }
+
+    @inlinable
+    @inline(__always)
+    func _shard(at index: Int) -> UnsafeMutablePointer<_Shard> {
+        return (_shards + index &* _shardStride).assumingMemoryBound(to: _Shard.self)
+    }
+
+    @usableFromInline
+    struct _Shard {
+        @usableFromInline var lock: RawMutex.RawValue = 0
+        @usableFromInline var storage = [Key: Value]()
+
+        @inlinable
+        init() {}
+    }
+}
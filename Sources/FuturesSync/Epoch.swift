@@ -0,0 +1,331 @@
+//
+//  Epoch.swift
+//  Futures
+//
+//  Copyright © 2019 Akis Kesoglou. Licensed under the MIT license.
+//
+
+// Loosely based on crossbeam-epoch: https://github.com/crossbeam-rs/crossbeam
+
+import FuturesPrivate
+
+/// Epoch-based memory reclamation.
+///
+/// Lock-free data structures cannot release an object as soon as they
+/// unlink it from shared memory, because other threads may have loaded a
+/// pointer to it and be just about to access it. Epoch-based reclamation
+/// solves this by having threads *pin* themselves for the duration of
+/// their accesses to shared memory, while objects that are unlinked are
+/// not released immediately but *deferred* until all threads that were
+/// pinned at the time have unpinned.
+///
+/// Pinning and unpinning are cheap, thread-local operations. Deferred
+/// actions are batched per thread and run once the global epoch has
+/// advanced twice since they were deferred, which is attempted every once
+/// in a while as threads defer more actions or pin themselves while they
+/// have actions pending, or explicitly via `collect()`.
+///
+///     let config = AtomicReference(Config())
+///
+///     // readers
+///     Epoch.withPinned { pin in
+///         let current = config.load(guard: pin)
+///         ...
+///     }
+///
+///     // writers
+///     Epoch.withPinned { pin in
+///         config.store(Config(), guard: pin)
+///     }
+///
+/// Pinning is reentrant; a thread remains pinned until the outermost guard
+/// is unpinned. Threads must not block for long periods while pinned, as
+/// that prevents the release of deferred objects process-wide.
+public enum Epoch {
+    /// Pins the current thread, returning a guard that must be unpinned
+    /// via `EpochGuard.unpin()` once the thread is done accessing shared
+    /// memory.
+    public static func pin() -> EpochGuard {
+        let participant = _EpochParticipant.current
+        participant.pin()
+        return .init(participant)
+    }
+
+    /// Pins the current thread for the duration of `body`.
+    @inlinable
+    public static func withPinned<R>(_ body: (EpochGuard) throws -> R) rethrows -> R {
+        let pin = self.pin()
+        defer { pin.unpin() }
+        return try body(pin)
+    }
+
+    /// Attempts to advance the global epoch and runs any deferred actions,
+    /// including those left behind by exited threads, that are now safe
+    /// to run.
+    ///
+    /// Actions deferred by a thread are otherwise only run when that thread
+    /// pins itself or defers more actions, so threads that are about to go
+    /// idle for a long time should call this a few times to flush them.
+    public static func collect() {
+        withPinned {
+            $0._participant.collect()
+        }
+    }
+}
+
+/// A witness that the current thread is pinned; see `Epoch`.
+///
+/// A guard must only be used on the thread that created it.
+public struct EpochGuard {
+    @usableFromInline let _participant: _EpochParticipant
+
+    @inlinable
+    init(_ participant: _EpochParticipant) {
+        _participant = participant
+    }
+
+    /// Unpins the current thread.
+    public func unpin() {
+        _participant.unpin()
+    }
+
+    /// Defers releasing the given reference until no thread that is
+    /// currently pinned can access it.
+    public func deferRelease<T: AnyObject>(_ ref: Unmanaged<T>) {
+        _participant.schedule(.release(.fromOpaque(ref.toOpaque())))
+    }
+
+    /// Defers invoking `fn` until no thread that is currently pinned can
+    /// access the memory it releases.
+    public func deferAction(_ fn: @escaping () -> Void) {
+        _participant.schedule(.call(fn))
+    }
+}
+
+// MARK: - Private -
+
+private let _PINNED: UInt = 1
+
+// The number of deferred actions a thread accumulates before it attempts
+// to advance the global epoch and run expired actions.
+private let _COLLECT_THRESHOLD = 64
+
+// The number of times a thread pins itself, while it or an exited thread
+// has deferred actions pending, before it attempts to advance the global
+// epoch and run expired actions. Makes sure that actions are eventually
+// run even if fewer than `_COLLECT_THRESHOLD` are ever deferred.
+private let _PINS_BETWEEN_COLLECTS = 128
+
+struct _EpochDeferred {
+    enum Action {
+        case release(Unmanaged<AnyObject>)
+        case call(() -> Void)
+    }
+
+    let epoch: UInt
+    let action: Action
+
+    func isExpired(_ globalEpoch: UInt) -> Bool {
+        return globalEpoch &- epoch >= 2
+    }
+
+    func run() {
+        switch action {
+        case .release(let ref):
+            ref.release()
+        case .call(let fn):
+            fn()
+        }
+    }
+}
+
+private final class _EpochGlobal {
+    typealias AtomicParticipant = AtomicReference<_EpochParticipant>
+
+    var epoch: AtomicUInt.RawValue = 0
+    var participants: AtomicParticipant.RawValue = 0
+    let orphans = Mutex<[_EpochDeferred]>([])
+    var orphanCount: AtomicInt.RawValue = 0 // updated with `orphans` locked
+
+    init() {
+        AtomicUInt.initialize(&epoch, to: 0)
+        AtomicParticipant.initialize(&participants, to: nil)
+        AtomicInt.initialize(&orphanCount, to: 0)
+    }
+
+    var hasOrphans: Bool {
+        return AtomicInt.load(&orphanCount, order: .relaxed) > 0
+    }
+
+    /// Returns a participant that is not in use by any thread, registering
+    /// a new one if needed. Participants are never removed from the list.
+    func acquireParticipant() -> _EpochParticipant {
+        var current = AtomicParticipant.load(&participants)
+        while let participant = current {
+            if !AtomicBool.exchange(&participant.inUse, true, order: .acquire) {
+                return participant
+            }
+            current = participant.next
+        }
+        let participant = _EpochParticipant()
+        var head = AtomicParticipant.load(&participants, order: .relaxed)
+        repeat {
+            participant.next = head
+        } while !AtomicParticipant.compareExchangeWeak(&participants, &head, participant, order: .acqrel)
+        return participant
+    }
+
+    /// Advances the global epoch if all pinned participants have observed
+    /// the current one and returns the global epoch.
+    func tryAdvance() -> UInt {
+        let epoch = AtomicUInt.load(&self.epoch, order: .relaxed)
+        Atomic.threadFence(order: .seqcst)
+
+        var current = AtomicParticipant.load(&participants)
+        while let participant = current {
+            let local = AtomicUInt.load(&participant.localEpoch, order: .relaxed)
+            if local & _PINNED != 0, local != epoch << 1 | _PINNED {
+                return epoch
+            }
+            current = participant.next
+        }
+        Atomic.threadFence(order: .acquire)
+
+        let next = epoch &+ 1
+        AtomicUInt.compareExchange(&self.epoch, epoch, next, order: .release, loadOrder: .relaxed)
+        return AtomicUInt.load(&self.epoch, order: .acquire)
+    }
+}
+
+private let _global = _EpochGlobal()
+
+@usableFromInline
+final class _EpochParticipant {
+    // shared
+    var localEpoch: AtomicUInt.RawValue = 0
+    var inUse: AtomicBool.RawValue = true
+    var next: _EpochParticipant? // immutable once published
+
+    // owned by the thread using the participant
+    var pinCount = 0
+    var pinsSinceCollect = 0
+    var deferred = [_EpochDeferred]()
+
+    init() {
+        AtomicUInt.initialize(&localEpoch, to: 0)
+        AtomicBool.initialize(&inUse, to: true)
+    }
+
+    func pin() {
+        pinCount += 1
+        guard pinCount == 1 else {
+            return
+        }
+        let epoch = AtomicUInt.load(&_global.epoch, order: .relaxed)
+        AtomicUInt.store(&localEpoch, epoch << 1 | _PINNED, order: .relaxed)
+        Atomic.threadFence(order: .seqcst)
+
+        if deferred.isEmpty && !_global.hasOrphans {
+            return
+        }
+        pinsSinceCollect += 1
+        if pinsSinceCollect >= _PINS_BETWEEN_COLLECTS || deferred.first?.isExpired(epoch) == true {
+            collect()
+        }
+    }
+
+    func unpin() {
+        precondition(pinCount > 0, "unbalanced call to unpin()")
+        pinCount -= 1
+        if pinCount == 0 {
+            AtomicUInt.store(&localEpoch, 0, order: .release)
+        }
+    }
+
+    func schedule(_ action: _EpochDeferred.Action) {
+        assert(pinCount > 0, "deferring actions requires a pinned thread")
+        let epoch = AtomicUInt.load(&_global.epoch, order: .relaxed)
+        deferred.append(.init(epoch: epoch, action: action))
+        if deferred.count >= _COLLECT_THRESHOLD {
+            collect()
+        }
+    }
+
+    func collect() {
+        pinsSinceCollect = 0
+        let epoch = _global.tryAdvance()
+        var expired = deferred._removeExpired(epoch)
+        if _global.hasOrphans {
+            _global.orphans.withMutableValue {
+                expired.append(contentsOf: $0._removeExpired(epoch))
+                AtomicInt.store(&_global.orphanCount, $0.count, order: .relaxed)
+            }
+        }
+        // Actions may defer further actions, so only run them once we're
+        // done mutating the lists.
+        for item in expired {
+            item.run()
+        }
+    }
+
+    /// Called when the owning thread exits.
+    func retire() {
+        let orphans = deferred
+        deferred = []
+        if !orphans.isEmpty {
+            _global.orphans.withMutableValue {
+                $0.append(contentsOf: orphans)
+                AtomicInt.store(&_global.orphanCount, $0.count, order: .relaxed)
+            }
+        }
+        pinCount = 0
+        pinsSinceCollect = 0
+        AtomicUInt.store(&localEpoch, 0, order: .release)
+        AtomicBool.store(&inUse, false, order: .release)
+    }
+}
+
+extension _EpochParticipant {
+    /// The participant of the current thread.
+    ///
+    /// The participant is cached in the thread's native thread-local state,
+    /// so that pinning doesn't go through `ThreadLocal` but the first time.
+    @inline(__always)
+    static var current: _EpochParticipant {
+        if let ptr = CThreadRuntimeGetCurrent().pointee.epochParticipant {
+            return Unmanaged<_EpochParticipant>.fromOpaque(ptr).takeUnretainedValue()
+        }
+        let participant = _currentParticipant.value.participant
+        CThreadRuntimeGetCurrent().pointee.epochParticipant = Unmanaged.passUnretained(participant).toOpaque()
+        return participant
+    }
+}
+
+private final class _EpochHandle {
+    let participant = _global.acquireParticipant()
+
+    deinit {
+        // Runs on the exiting thread; the participant may be reused by
+        // another thread once retired, so stop using it first.
+        CThreadRuntimeGetCurrent().pointee.epochParticipant = nil
+        participant.retire()
+    }
+}
+
+private let _currentParticipant = ThreadLocal {
+    _EpochHandle()
+}
+
+extension Array where Element == _EpochDeferred {
+    fileprivate mutating func _removeExpired(_ epoch: UInt) -> [_EpochDeferred] {
+        var expired = [_EpochDeferred]()
+        removeAll {
+            if $0.isExpired(epoch) {
+                expired.append($0)
+                return true
+            }
+            return false
+        }
+        return expired
+    }
+}
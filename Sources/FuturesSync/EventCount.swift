@@ -0,0 +1,165 @@
+//
+//  EventCount.swift
+//  Futures
+//
+//  Copyright © 2019 Akis Kesoglou. Licensed under the MIT license.
+//
+
+// Based on Dmitry Vyukov's eventcount and folly's EventCount.
+
+#if canImport(Darwin)
+import Darwin.POSIX.pthread
+#else
+import Glibc
+#endif
+
+// The state holds the number of waiters in the low 32 bits and the epoch,
+// which is incremented on every notification that finds waiters, in the
+// high 32 bits.
+@usableFromInline let _EVENT_COUNT_WAITER: UInt64 = 1
+@usableFromInline let _EVENT_COUNT_WAITER_MASK: UInt64 = 0xFFFF_FFFF
+@usableFromInline let _EVENT_COUNT_EPOCH_SHIFT: UInt64 = 32
+@usableFromInline let _EVENT_COUNT_EPOCH: UInt64 = 1 << _EVENT_COUNT_EPOCH_SHIFT
+
+/// A primitive for blocking threads until a condition, typically on a
+/// lock-free data structure, becomes true, without losing wake-ups.
+///
+/// A waiting thread first announces its intent to wait with `prepareWait()`,
+/// then re-checks its condition and either calls `cancelWait()` if the
+/// condition is now true, or `commitWait(_:)` to block. A notifying thread
+/// makes the condition true and then calls `notifyOne()` or `notifyAll()`.
+///
+///     let event = EventCount()
+///     let queue = AtomicUnboundedMPMCQueue<Int>()
+///
+///     // consumer
+///     while true {
+///         if let item = queue.pop() {
+///             return item
+///         }
+///         let key = event.prepareWait()
+///         if let item = queue.pop() {
+///             event.cancelWait()
+///             return item
+///         }
+///         event.commitWait(key)
+///     }
+///
+///     // producer
+///     queue.push(item)
+///     event.notifyOne()
+///
+/// Notifying is free of locks and read-modify-write operations when there
+/// are no waiters, so producers only pay for waking consumers up when
+/// consumers actually are waiting. Waiting threads are parked in the global
+/// `ParkingLot`.
+public final class EventCount {
+    /// A token returned by `prepareWait()`, to be passed to `commitWait(_:)`.
+    public struct Key {
+        @usableFromInline let _epoch: UInt64
+
+        @inlinable
+        init(_ epoch: UInt64) {
+            _epoch = epoch
+        }
+    }
+
+    @usableFromInline var _state: AtomicUInt64.RawValue = 0
+
+    @inlinable
+    public init() {
+        AtomicUInt64.initialize(&_state, to: 0)
+    }
+
+    /// Announces that the current thread intends to wait. The caller must
+    /// re-check its condition after this call, and then either call
+    /// `cancelWait()` or `commitWait(_:)`.
+    @inlinable
+    public func prepareWait() -> Key {
+        let prev = AtomicUInt64.fetchAdd(&_state, _EVENT_COUNT_WAITER, order: .relaxed)
+        // Pairs with the fence in `notify*()`; either the notifier sees us
+        // as a waiter, or we see the condition it made true.
+        Atomic.threadFence()
+        return Key(prev >> _EVENT_COUNT_EPOCH_SHIFT)
+    }
+
+    /// Withdraws the intent to wait announced by `prepareWait()`.
+    @inlinable
+    public func cancelWait() {
+        AtomicUInt64.fetchSub(&_state, _EVENT_COUNT_WAITER, order: .relaxed)
+    }
+
+    /// Blocks the current thread until a notification arrives after the
+    /// call to `prepareWait()` that returned `key`, or `deadline` is reached.
+    ///
+    /// Returns immediately if a notification already arrived. Note that
+    /// notifications are not tied to any particular waiter; when this
+    /// method returns, the caller must re-check its condition.
+    ///
+    /// - Parameter deadline: The absolute time, in seconds and nanoseconds
+    ///     since the Unix Epoch, at which to give up waiting; see
+    ///     `PosixConditionLock.wait(until:)`. Pass `nil` to wait
+    ///     indefinitely.
+    /// - Returns: `false` if the deadline was reached; `true` otherwise.
+    @discardableResult
+    public func commitWait(_ key: Key, deadline: timespec? = nil) -> Bool {
+        defer {
+            AtomicUInt64.fetchSub(&_state, _EVENT_COUNT_WAITER, order: .relaxed)
+        }
+        let result = ParkingLot.park(
+            address: _address,
+            validate: { self._epoch == key._epoch },
+            deadline: deadline
+        )
+        // A notification may have arrived just as we timed out.
+        return result != .timedOut || _epoch != key._epoch
+    }
+
+    /// Wakes up one waiting thread, if any.
+    ///
+    /// Waiters that called `prepareWait()` but have not blocked yet are not
+    /// going to block either.
+    @inlinable
+    public func notifyOne() {
+        if _hasWaiters() {
+            _notify(all: false)
+        }
+    }
+
+    /// Wakes up all waiting threads, if any.
+    @inlinable
+    public func notifyAll() {
+        if _hasWaiters() {
+            _notify(all: true)
+        }
+    }
+
+    @inlinable
+    @inline(__always)
+    func _hasWaiters() -> Bool {
+        Atomic.threadFence()
+        return AtomicUInt64.load(&_state, order: .relaxed) & _EVENT_COUNT_WAITER_MASK != 0
+    }
+
+    @usableFromInline
+    func _notify(all: Bool) {
+        // Bumping the epoch prevents waiters that are about to block from
+        // blocking; the parking lot's queue lock, which `commitWait(_:)`
+        // holds while validating the epoch, ensures the rest are parked by
+        // the time we unpark them.
+        AtomicUInt64.fetchAdd(&_state, _EVENT_COUNT_EPOCH, order: .acqrel)
+        if all {
+            ParkingLot.unparkAll(address: _address)
+        } else {
+            ParkingLot.unparkOne(address: _address)
+        }
+    }
+
+    private var _epoch: UInt64 {
+        return AtomicUInt64.load(&_state, order: .acquire) >> _EVENT_COUNT_EPOCH_SHIFT
+    }
+
+    private var _address: UnsafeRawPointer {
+        return UnsafeRawPointer(Unmanaged.passUnretained(self).toOpaque())
+    }
+}
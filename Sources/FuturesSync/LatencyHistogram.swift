@@ -0,0 +1,292 @@
+//
+//  LatencyHistogram.swift
+//  Futures
+//
+//  Copyright © 2019 Akis Kesoglou. Licensed under the MIT license.
+//
+
+// Modelled after HdrHistogram.
+
+// The alignment of each shard. Larger than a typical cache line, to also
+// keep shards apart on processors that prefetch adjacent lines in pairs.
+private let _LATENCY_HISTOGRAM_SHARD_ALIGNMENT = 128
+
+/// A histogram of durations, in nanoseconds, that can be recorded into from
+/// multiple threads at the cost of a relaxed atomic increment.
+///
+/// Values are counted in log-linear buckets: each power of 2 is split into
+/// `2^precision` equally sized buckets, so that any recorded value can be
+/// reported with a relative error of at most `2^-precision`, and values
+/// below `2^(precision + 1)` are recorded exactly. The number of buckets,
+/// and therefore the memory the histogram takes up, depends only on the
+/// precision and the maximum value it can record; larger values are
+/// recorded as `maximum`.
+///
+/// When many threads record into the same histogram, updates to the same
+/// buckets contend for the cache lines that hold them. Such histograms can
+/// be split into several shards, each thread recording into the shard it
+/// maps to, at the cost of memory and of summing shards when reading.
+///
+/// Reading the histogram takes a snapshot of all buckets, which is not
+/// atomic; concurrent recordings may or may not be reflected in it.
+/// Resetting the histogram is atomic per bucket however, so concurrent
+/// recordings are either reflected in the returned snapshot or retained in
+/// the histogram.
+public final class LatencyHistogram {
+    /// The default precision; values are recorded with a relative error of
+    /// at most 2^-5, or about 3%.
+    public static let defaultPrecision = 5
+
+    /// The default maximum value; one hour, in nanoseconds.
+    public static let defaultMaximum: UInt64 = 3_600_000_000_000
+
+    /// The number of buckets each power of 2 is split into, as a power of 2.
+    public let precision: Int
+
+    /// The largest value that can be recorded. Larger values are recorded as
+    /// `maximum`.
+    public let maximum: UInt64
+
+    @usableFromInline let _buckets: UnsafeMutablePointer<AtomicInt.RawValue>
+    @usableFromInline let _bucketCount: Int
+    @usableFromInline let _shardStride: Int
+    @usableFromInline let _mask: Int
+
+    /// Creates an empty histogram.
+    ///
+    /// - Parameters:
+    ///     - precision: The number of buckets each power of 2 is split into,
+    ///       as a power of 2. Must be between 1 and 10.
+    ///     - maximum: The largest value that can be recorded.
+    ///     - shards: The number of shards recordings are spread over. Must
+    ///       be a power of 2. Use `StripedCounter.defaultStripes` for
+    ///       histograms that many threads record into.
+    public init(
+        precision: Int = LatencyHistogram.defaultPrecision,
+        maximum: UInt64 = LatencyHistogram.defaultMaximum,
+        shards: Int = 1
+    ) {
+        precondition((1...10).contains(precision), "precision must be between 1 and 10")
+        precondition(shards > 0 && isPowerOf2(shards), "shards must be a power of 2")
+        self.precision = precision
+        self.maximum = maximum
+        _bucketCount = LatencyHistogram._index(maximum, precision: precision) + 1
+        let alignment = _LATENCY_HISTOGRAM_SHARD_ALIGNMENT / MemoryLayout<AtomicInt.RawValue>.stride
+        _shardStride = (_bucketCount + alignment - 1) / alignment * alignment
+        _mask = shards - 1
+        let capacity = shards * _shardStride
+        _buckets = UnsafeMutableRawPointer.allocate(
+            byteCount: capacity * MemoryLayout<AtomicInt.RawValue>.stride,
+            alignment: _LATENCY_HISTOGRAM_SHARD_ALIGNMENT
+        ).bindMemory(to: AtomicInt.RawValue.self, capacity: capacity)
+        for i in 0..<capacity {
+            AtomicInt.initialize(_buckets + i, to: 0)
+        }
+    }
+
+    deinit {
+        _buckets.deallocate()
+    }
+
+    /// The number of shards recordings are spread over.
+    public var shards: Int {
+        return _mask + 1
+    }
+
+    /// Records a duration.
+    @inlinable
+    public func record(_ nanoseconds: UInt64) {
+        let index = LatencyHistogram._index(Swift.min(nanoseconds, maximum), precision: precision)
+        let shard = _mask == 0 ? 0 : ThreadRuntime.threadIndex & _mask
+        AtomicInt.fetchAdd(_buckets + (shard &* _shardStride &+ index), 1, order: .relaxed)
+    }
+
+    /// Adds the durations in `snapshot` to the histogram.
+    ///
+    /// - Precondition: `snapshot` must have been taken from a histogram with
+    ///     the same precision.
+    public func merge(_ snapshot: Snapshot) {
+        precondition(snapshot.precision == precision, "cannot merge histograms of different precision")
+        for (index, count) in snapshot._counts.enumerated() where count != 0 {
+            AtomicInt.fetchAdd(_buckets + Swift.min(index, _bucketCount - 1), count, order: .relaxed)
+        }
+    }
+
+    /// The durations recorded since the histogram was created or last reset.
+    public var snapshot: Snapshot {
+        return _collect { AtomicInt.load($0, order: .relaxed) }
+    }
+
+    /// Empties the histogram and returns the durations it held.
+    @discardableResult
+    public func reset() -> Snapshot {
+        return _collect { AtomicInt.exchange($0, 0, order: .relaxed) }
+    }
+
+    private func _collect(_ read: (AtomicInt.Pointer) -> Int) -> Snapshot {
+        var counts = [Int](repeating: 0, count: _bucketCount)
+        for shard in 0...(_mask) {
+            let buckets = _buckets + shard * _shardStride
+            for i in 0..<_bucketCount {
+                counts[i] &+= read(buckets + i)
+            }
+        }
+        return Snapshot(precision: precision, counts: counts)
+    }
+
+    /// Returns the index of the bucket `value` is recorded in.
+    @inlinable
+    @inline(__always)
+    static func _index(_ value: UInt64, precision: Int) -> Int {
+        if value >> UInt64(precision + 1) == 0 {
+            return Int(truncatingIfNeeded: value)
+        }
+        let shift = UInt64.bitWidth - 1 - value.leadingZeroBitCount - precision
+        return shift << precision + Int(truncatingIfNeeded: value >> UInt64(shift))
+    }
+
+    /// Returns the range of values recorded in the bucket at `index`.
+    static func _range(ofBucket index: Int, precision: Int) -> ClosedRange<UInt64> {
+        if index >> (precision + 1) == 0 {
+            return UInt64(index)...UInt64(index)
+        }
+        let shift = index >> precision - 1
+        let lower = UInt64(index - shift << precision) << UInt64(shift)
+        return lower...(lower + (1 << UInt64(shift) - 1))
+    }
+}
+
+extension LatencyHistogram {
+    /// The contents of a histogram at some point in time.
+    public struct Snapshot: Equatable {
+        /// A range of values and the number of durations recorded in it.
+        public struct Bucket: Equatable {
+            /// The values recorded in the bucket.
+            public var range: ClosedRange<UInt64>
+
+            /// The number of durations recorded in the bucket.
+            public var count: Int
+        }
+
+        /// The precision of the histogram the snapshot was taken from.
+        public let precision: Int
+
+        var _counts: [Int]
+
+        /// Creates an empty snapshot, to merge other snapshots into.
+        public init(precision: Int = LatencyHistogram.defaultPrecision) {
+            precondition((1...10).contains(precision), "precision must be between 1 and 10")
+            self.init(precision: precision, counts: [])
+        }
+
+        init(precision: Int, counts: [Int]) {
+            self.precision = precision
+            _counts = counts
+        }
+
+        /// The number of durations recorded.
+        public var count: Int {
+            return _counts.reduce(0, &+)
+        }
+
+        /// Whether no durations were recorded.
+        public var isEmpty: Bool {
+            return !_counts.contains { $0 != 0 }
+        }
+
+        /// The non-empty buckets, in ascending order of values.
+        public var buckets: [Bucket] {
+            return _counts.enumerated().compactMap { index, count in
+                guard count != 0 else { return nil }
+                let range = LatencyHistogram._range(ofBucket: index, precision: precision)
+                return Bucket(range: range, count: count)
+            }
+        }
+
+        /// A lower bound of the smallest duration recorded, in nanoseconds.
+        /// Returns 0 if the snapshot is empty.
+        public var min: UInt64 {
+            guard let index = _counts.firstIndex(where: { $0 != 0 }) else {
+                return 0
+            }
+            return LatencyHistogram._range(ofBucket: index, precision: precision).lowerBound
+        }
+
+        /// An upper bound of the largest duration recorded, in nanoseconds.
+        /// Returns 0 if the snapshot is empty.
+        public var max: UInt64 {
+            guard let index = _counts.lastIndex(where: { $0 != 0 }) else {
+                return 0
+            }
+            return LatencyHistogram._range(ofBucket: index, precision: precision).upperBound
+        }
+
+        /// An estimate of the mean of the recorded durations, in
+        /// nanoseconds, taking the midpoint of each bucket as the value of
+        /// the durations recorded in it. Returns 0 if the snapshot is empty.
+        public var mean: Double {
+            var total = 0.0
+            var count = 0
+            for bucket in buckets {
+                let midpoint = Double(bucket.range.lowerBound) / 2 + Double(bucket.range.upperBound) / 2
+                total += midpoint * Double(bucket.count)
+                count += bucket.count
+            }
+            return count == 0 ? 0 : total / Double(count)
+        }
+
+        /// An upper bound of the given percentile of the recorded durations,
+        /// in nanoseconds; the largest value of the bucket the percentile
+        /// falls in. Returns 0 if the snapshot is empty.
+        ///
+        /// - Parameter percentile: A number between 0 and 100.
+        public func percentile(_ percentile: Double) -> UInt64 {
+            precondition((0...100).contains(percentile), "percentile must be between 0 and 100")
+            let rank = Swift.max(Int((Double(count) * percentile / 100).rounded(.up)), 1)
+            var seen = 0
+            for (index, count) in _counts.enumerated() where count != 0 {
+                seen += count
+                if seen >= rank {
+                    return LatencyHistogram._range(ofBucket: index, precision: precision).upperBound
+                }
+            }
+            return 0
+        }
+
+        /// Adds the durations in `other` to the snapshot.
+        ///
+        /// - Precondition: `other` must have been taken from a histogram
+        ///     with the same precision.
+        public mutating func merge(_ other: Snapshot) {
+            precondition(other.precision == precision, "cannot merge histograms of different precision")
+            if _counts.count < other._counts.count {
+                _counts.append(contentsOf: repeatElement(0, count: other._counts.count - _counts.count))
+            }
+            for (index, count) in other._counts.enumerated() {
+                _counts[index] &+= count
+            }
+        }
+
+        /// Returns a snapshot with the durations in both the receiver and
+        /// `other`.
+        ///
+        /// - Precondition: `other` must have been taken from a histogram
+        ///     with the same precision.
+        public func merging(_ other: Snapshot) -> Snapshot {
+            var result = self
+            result.merge(other)
+            return result
+        }
+
+        public static func == (lhs: Snapshot, rhs: Snapshot) -> Bool {
+            // snapshots of histograms with different maximums differ in
+            // the number of trailing empty buckets
+            let (shorter, longer) = lhs._counts.count < rhs._counts.count
+                ? (lhs._counts, rhs._counts)
+                : (rhs._counts, lhs._counts)
+            return lhs.precision == rhs.precision
+                && longer.starts(with: shorter)
+                && !longer[shorter.count...].contains { $0 != 0 }
+        }
+    }
+}
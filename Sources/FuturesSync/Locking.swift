@@ -36,3 +36,40 @@ extension LockingProtocol {
         return try fn()
     }
 }
+
+/// A lock that can be acquired either exclusively, by a single writer, or
+/// shared, by any number of readers.
+///
+/// The `LockingProtocol` requirements acquire and release the lock
+/// exclusively.
+public protocol ReadWriteLockingProtocol: LockingProtocol {
+    /// Attempts to acquire the lock for reading without blocking a thread's
+    /// execution and returns a Boolean value that indicates whether the
+    /// attempt was successful.
+    func tryAcquireShared() -> Bool
+
+    /// Attempts to acquire the lock for reading, blocking a thread's
+    /// execution until the lock can be acquired.
+    func acquireShared()
+
+    /// Relinquishes a previously acquired read lock.
+    func releaseShared()
+}
+
+extension ReadWriteLockingProtocol {
+    @inlinable
+    @inline(__always)
+    public func syncShared<R>(_ fn: () throws -> R) rethrows -> R {
+        acquireShared()
+        defer { releaseShared() }
+        return try fn()
+    }
+
+    @inlinable
+    @inline(__always)
+    public func trySyncShared<R>(_ fn: () throws -> R) rethrows -> R? {
+        guard tryAcquireShared() else { return nil }
+        defer { releaseShared() }
+        return try fn()
+    }
+}
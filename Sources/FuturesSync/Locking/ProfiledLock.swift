@@ -0,0 +1,234 @@
+//
+//  ProfiledLock.swift
+//  Futures
+//
+//  Copyright © 2019 Akis Kesoglou. Licensed under the MIT license.
+//
+
+/// A lock that wraps another lock and records how contended it is.
+///
+/// Contention on locks that spin rarely shows up in sampling profilers, as
+/// the time is spent in the lock's own code rather than in a system call.
+/// Wrap a lock in `ProfiledLock` to find out: every acquisition is recorded
+/// in a `LockProfile`, shared by all locks created with the same label, and
+/// the profiles of all labels can be dumped with `LockProfiler.report()`.
+///
+///     let lock = ProfiledLock(PosixLock(), label: "Cache.lock")
+///     ...
+///     print(LockProfiler.report())
+///
+/// An acquisition is contended if the underlying lock could not be acquired
+/// immediately. The wrapper then spins for a little while, retrying, before
+/// falling back to the underlying lock's `acquire()`; the time from the
+/// first attempt until the lock is acquired is recorded as the wait time.
+/// The time from acquiring to releasing the lock is recorded as the hold
+/// time.
+///
+/// Profiling adds the cost of reading the cycle counter twice per critical
+/// section, plus a few relaxed atomic increments, and is meant to be turned
+/// on while investigating rather than left in production code.
+public final class ProfiledLock<Lock: LockingProtocol>: LockingProtocol {
+    /// The profile acquisitions are recorded into.
+    public let profile: LockProfile
+
+    @usableFromInline let _lock: Lock
+
+    // Only accessed by the thread holding the lock.
+    @usableFromInline var _acquiredAt: UInt64 = 0
+
+    /// Creates a lock wrapping `lock`, that records acquisitions into the
+    /// profile registered for `label`.
+    @inlinable
+    public convenience init(_ lock: Lock, label: String) {
+        self.init(lock, profile: LockProfiler.profile(for: label))
+    }
+
+    /// Creates a lock wrapping `lock`, that records acquisitions into
+    /// `profile`.
+    @inlinable
+    public init(_ lock: Lock, profile: LockProfile) {
+        _lock = lock
+        self.profile = profile
+    }
+
+    @inlinable
+    public func tryAcquire() -> Bool {
+        guard _lock.tryAcquire() else {
+            profile._failedTryAcquisitions.increment()
+            return false
+        }
+        profile._acquisitions.increment()
+        _acquiredAt = MonotonicClock.cycles.now()
+        return true
+    }
+
+    @inlinable
+    public func acquire() {
+        if _lock.tryAcquire() {
+            profile._acquisitions.increment()
+            _acquiredAt = MonotonicClock.cycles.now()
+            return
+        }
+        _acquireContended()
+    }
+
+    @inlinable
+    public func release() {
+        let heldFor = MonotonicClock.cycles.now() &- _acquiredAt
+        _lock.release()
+        profile._holdTimes.record(heldFor)
+    }
+
+    @usableFromInline
+    func _acquireContended() {
+        let start = MonotonicClock.cycles.now()
+        var spins = 0
+        var acquired = false
+        var backoff = Backoff()
+        while backoff._isSpinning {
+            backoff.snooze()
+            spins += 1
+            if _lock.tryAcquire() {
+                acquired = true
+                break
+            }
+        }
+        if !acquired {
+            _lock.acquire()
+        }
+        let now = MonotonicClock.cycles.now()
+        _acquiredAt = now
+        profile._acquisitions.increment()
+        profile._contendedAcquisitions.increment()
+        profile._spins.increment(by: spins)
+        profile._waitTimes.record(now &- start)
+    }
+}
+
+// MARK: - Profiles -
+
+/// The contention statistics of one or more locks sharing a label.
+public final class LockProfile {
+    /// A label identifying the locks.
+    public let label: String
+
+    @usableFromInline let _acquisitions = StripedCounter()
+    @usableFromInline let _contendedAcquisitions = StripedCounter()
+    @usableFromInline let _failedTryAcquisitions = StripedCounter()
+    @usableFromInline let _spins = StripedCounter()
+    @usableFromInline let _waitTimes = LatencyHistogram(shards: StripedCounter.defaultStripes)
+    @usableFromInline let _holdTimes = LatencyHistogram(shards: StripedCounter.defaultStripes)
+
+    /// Creates a profile that is not registered with `LockProfiler`.
+    public init(label: String) {
+        self.label = label
+    }
+
+    /// A snapshot of the statistics of a profile.
+    public struct Statistics: Equatable {
+        /// The label of the profile.
+        public var label: String
+
+        /// The number of times the lock was acquired.
+        public var acquisitions: Int
+
+        /// The number of times the lock could not be acquired immediately.
+        public var contendedAcquisitions: Int
+
+        /// The number of times `tryAcquire()` failed.
+        public var failedTryAcquisitions: Int
+
+        /// The number of times contended acquisitions spun, retrying, before
+        /// acquiring the lock or blocking.
+        public var spins: Int
+
+        /// How long contended acquisitions waited for the lock.
+        public var waitTimes: LatencyHistogram.Snapshot
+
+        /// How long the lock was held.
+        public var holdTimes: LatencyHistogram.Snapshot
+    }
+
+    /// The statistics gathered since the profile was created or last reset.
+    public var statistics: Statistics {
+        Statistics(
+            label: label,
+            acquisitions: _acquisitions.sum,
+            contendedAcquisitions: _contendedAcquisitions.sum,
+            failedTryAcquisitions: _failedTryAcquisitions.sum,
+            spins: _spins.sum,
+            waitTimes: _waitTimes.snapshot,
+            holdTimes: _holdTimes.snapshot
+        )
+    }
+
+    /// Resets statistics and returns their previous values.
+    @discardableResult
+    public func resetStatistics() -> Statistics {
+        Statistics(
+            label: label,
+            acquisitions: _acquisitions.reset(),
+            contendedAcquisitions: _contendedAcquisitions.reset(),
+            failedTryAcquisitions: _failedTryAcquisitions.reset(),
+            spins: _spins.reset(),
+            waitTimes: _waitTimes.reset(),
+            holdTimes: _holdTimes.reset()
+        )
+    }
+}
+
+extension LockProfile.Statistics: CustomStringConvertible {
+    public var description: String {
+        let ratio = acquisitions == 0 ? 0 : Double(contendedAcquisitions) / Double(acquisitions) * 100
+        return "\(label): \(acquisitions) acquisitions, \(contendedAcquisitions) contended " +
+            "(\((ratio * 100).rounded() / 100)%), \(spins) spins, \(failedTryAcquisitions) failed tries; " +
+            "wait p50 <= \(waitTimes.percentile(50))ns, p99 <= \(waitTimes.percentile(99))ns; " +
+            "hold p50 <= \(holdTimes.percentile(50))ns, p99 <= \(holdTimes.percentile(99))ns"
+    }
+}
+
+/// The process-wide registry of lock profiles.
+public enum LockProfiler {
+    /// Returns the profile registered for `label`, registering a new one if
+    /// there is none.
+    public static func profile(for label: String) -> LockProfile {
+        return _profiles.withMutableValue { profiles in
+            if let profile = profiles[label] {
+                return profile
+            }
+            let profile = LockProfile(label: label)
+            profiles[label] = profile
+            return profile
+        }
+    }
+
+    /// The statistics of all registered profiles, most contended first.
+    public static var statistics: [LockProfile.Statistics] {
+        return _sorted(_allProfiles.map { $0.statistics })
+    }
+
+    /// Resets the statistics of all registered profiles and returns their
+    /// previous values, most contended first.
+    @discardableResult
+    public static func resetStatistics() -> [LockProfile.Statistics] {
+        return _sorted(_allProfiles.map { $0.resetStatistics() })
+    }
+
+    /// Returns a human-readable report of the statistics of all registered
+    /// profiles, one line per profile, most contended first.
+    public static func report() -> String {
+        return statistics.map { $0.description }.joined(separator: "\n")
+    }
+
+    private static var _allProfiles: [LockProfile] {
+        return _profiles.withMutableValue { Array($0.values) }
+    }
+
+    private static func _sorted(_ statistics: [LockProfile.Statistics]) -> [LockProfile.Statistics] {
+        return statistics.sorted {
+            ($0.contendedAcquisitions, $1.label) > ($1.contendedAcquisitions, $0.label)
+        }
+    }
+}
+
+private let _profiles = Mutex([String: LockProfile](), lock: PosixLock())
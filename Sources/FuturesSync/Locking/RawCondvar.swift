@@ -0,0 +1,153 @@
+//
+//  RawCondvar.swift
+//  Futures
+//
+//  Copyright © 2019 Akis Kesoglou. Licensed under the MIT license.
+//
+
+#if canImport(Darwin)
+import Darwin.POSIX.pthread
+#else
+import Glibc
+#endif
+
+/// A condition variable that occupies a single byte, to be used in
+/// conjunction with `RawMutex`.
+///
+/// The semantics are the same as those of `PosixConditionLock`, except that
+/// the lock is a separate object which must be passed to the `wait` methods.
+/// Waiting threads are parked in the global `ParkingLot`, so signalling the
+/// condition when no thread is waiting on it is very cheap.
+///
+/// You must lock the mutex prior to waiting on the condition and must only
+/// update the condition's predicate while holding the mutex. Spurious
+/// wakeups are possible, so the predicate must be retested after every
+/// call to `wait`.
+///
+/// The condition can be embedded in other objects by storing a `RawValue`
+/// and using the static methods that operate on a pointer to it.
+public final class RawCondvar {
+    public typealias Pointer = AtomicUInt8.Pointer
+    public typealias RawValue = AtomicUInt8.RawValue
+
+    @usableFromInline var _state: RawValue = 0
+
+    @inlinable
+    public init() {
+        RawCondvar.initialize(&_state)
+    }
+
+    /// Signals the condition, waking up one thread waiting on it.
+    ///
+    /// - Returns: `true` if a thread was woken up.
+    @inlinable
+    @discardableResult
+    public func signal() -> Bool {
+        return RawCondvar.signal(&_state)
+    }
+
+    /// Signals the condition, waking up all threads waiting on it.
+    ///
+    /// - Returns: The number of threads that were woken up.
+    @inlinable
+    @discardableResult
+    public func broadcast() -> Int {
+        return RawCondvar.broadcast(&_state)
+    }
+
+    /// Atomically releases `mutex` and blocks the current thread until the
+    /// condition is signaled. The mutex is reacquired before returning.
+    @inlinable
+    public func wait(_ mutex: RawMutex) {
+        RawCondvar.wait(&_state, mutex: &mutex._state)
+    }
+
+    /// Atomically releases `mutex` and blocks the current thread until the
+    /// condition is signaled or the specified time limit is reached. The
+    /// mutex is reacquired before returning.
+    ///
+    /// - Parameter deadline: The absolute time, in seconds and nanoseconds
+    ///     since the Unix Epoch, at which to wake up the thread if the
+    ///     condition has not been signaled.
+    /// - Returns: `true` if the condition was signaled; otherwise, `false` if
+    ///     the time limit was reached.
+    @inlinable
+    public func wait(_ mutex: RawMutex, until deadline: timespec) -> Bool {
+        return RawCondvar.wait(&_state, mutex: &mutex._state, until: deadline)
+    }
+}
+
+extension RawCondvar {
+    @_transparent
+    public static func initialize(_ ptr: Pointer) {
+        AtomicUInt8.initialize(ptr, to: 0)
+    }
+
+    @inlinable
+    @discardableResult
+    public static func signal(_ ptr: Pointer) -> Bool {
+        // The flag is set by waiters while they still hold the mutex, so
+        // if it's clear there is nobody to wake up.
+        if AtomicUInt8.load(ptr, order: .relaxed) == 0 {
+            return false
+        }
+        return _signalSlow(ptr)
+    }
+
+    @inlinable
+    @discardableResult
+    public static func broadcast(_ ptr: Pointer) -> Int {
+        if AtomicUInt8.load(ptr, order: .relaxed) == 0 {
+            return 0
+        }
+        return _broadcastSlow(ptr)
+    }
+
+    public static func wait(_ ptr: Pointer, mutex: RawMutex.Pointer) {
+        _ = _wait(ptr, mutex: mutex, deadline: nil)
+    }
+
+    public static func wait(_ ptr: Pointer, mutex: RawMutex.Pointer, until deadline: timespec) -> Bool {
+        return _wait(ptr, mutex: mutex, deadline: deadline)
+    }
+
+    @usableFromInline
+    @inline(never)
+    static func _signalSlow(_ ptr: Pointer) -> Bool {
+        let result = ParkingLot.unparkOne(address: ptr) { result in
+            if !result.haveMoreThreads {
+                AtomicUInt8.store(ptr, 0, order: .relaxed)
+            }
+            return ParkingLot.DEFAULT_UNPARK_TOKEN
+        }
+        return result.unparkedThreads != 0
+    }
+
+    @usableFromInline
+    @inline(never)
+    static func _broadcastSlow(_ ptr: Pointer) -> Int {
+        AtomicUInt8.store(ptr, 0, order: .relaxed)
+        return ParkingLot.unparkAll(address: ptr)
+    }
+
+    private static func _wait(_ ptr: Pointer, mutex: RawMutex.Pointer, deadline: timespec?) -> Bool {
+        let result = ParkingLot.park(
+            address: ptr,
+            validate: {
+                AtomicUInt8.store(ptr, 1, order: .relaxed)
+                return true
+            },
+            beforeSleep: {
+                RawMutex.release(mutex)
+            },
+            timedOut: { wasLastThread in
+                if wasLastThread {
+                    AtomicUInt8.store(ptr, 0, order: .relaxed)
+                }
+            },
+            deadline: deadline
+        )
+        RawMutex.acquire(mutex)
+        return result != .timedOut
+    }
+}
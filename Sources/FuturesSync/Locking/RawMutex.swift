@@ -0,0 +1,191 @@
+//
+//  RawMutex.swift
+//  Futures
+//
+//  Copyright © 2019 Akis Kesoglou. Licensed under the MIT license.
+//
+
+// Ported over from parking_lot: https://github.com/Amanieu/parking_lot
+
+@usableFromInline let _RAW_MUTEX_LOCKED: UInt8 = 0b01
+@usableFromInline let _RAW_MUTEX_PARKED: UInt8 = 0b10
+
+// The maximum number of times a thread spins before parking, as long as no
+// other thread is already parked on the lock.
+private let _RAW_MUTEX_MAX_SPINS = 10
+
+// Passed to a thread that is unparked by `releaseFair()` to denote that the
+// lock was handed off to it directly.
+private let _RAW_MUTEX_HANDOFF: ParkingLot.Token = 1
+
+/// A mutual exclusion lock that occupies a single byte.
+///
+/// `RawMutex` spins for a short while when contended, then parks the thread
+/// in the global `ParkingLot` until the lock is released. Since all the
+/// bookkeeping for waiting threads lives in the parking lot, the lock itself
+/// only needs two bits of state, which makes it suitable for cases where a
+/// very large number of locks is required, e.g. one per object.
+///
+/// Unlocking is not fair by default; a thread that releases the lock can
+/// immediately reacquire it before any woken up waiter gets a chance to.
+/// Use `releaseFair()` to hand off the lock directly to the next waiter.
+///
+/// The lock can be embedded in other objects by storing a `RawValue` and
+/// using the static methods that operate on a pointer to it.
+public final class RawMutex: LockingProtocol {
+    public typealias Pointer = AtomicUInt8.Pointer
+    public typealias RawValue = AtomicUInt8.RawValue
+
+    @usableFromInline var _state: RawValue = 0
+
+    @inlinable
+    public init() {
+        RawMutex.initialize(&_state)
+    }
+
+    @inlinable
+    public func tryAcquire() -> Bool {
+        return RawMutex.tryAcquire(&_state)
+    }
+
+    @inlinable
+    public func acquire() {
+        RawMutex.acquire(&_state)
+    }
+
+    @inlinable
+    public func release() {
+        RawMutex.release(&_state)
+    }
+
+    /// Relinquishes a previously acquired lock, handing it off directly to
+    /// the next thread waiting on it, if any.
+    @inlinable
+    public func releaseFair() {
+        RawMutex.releaseFair(&_state)
+    }
+
+    /// A boolean denoting whether the lock is currently held by any thread.
+    @inlinable
+    public var isLocked: Bool {
+        return RawMutex.isLocked(&_state)
+    }
+}
+
+extension RawMutex {
+    @_transparent
+    public static func initialize(_ ptr: Pointer) {
+        AtomicUInt8.initialize(ptr, to: 0)
+    }
+
+    @inlinable
+    public static func isLocked(_ ptr: Pointer) -> Bool {
+        return AtomicUInt8.load(ptr, order: .relaxed) & _RAW_MUTEX_LOCKED != 0
+    }
+
+    @inlinable
+    public static func tryAcquire(_ ptr: Pointer) -> Bool {
+        var state = AtomicUInt8.load(ptr, order: .relaxed)
+        while state & _RAW_MUTEX_LOCKED == 0 {
+            if AtomicUInt8.compareExchangeWeak(ptr, &state, state | _RAW_MUTEX_LOCKED, order: .acquire, loadOrder: .relaxed) {
+                return true
+            }
+        }
+        return false
+    }
+
+    @inlinable
+    public static func acquire(_ ptr: Pointer) {
+        if AtomicUInt8.compareExchange(ptr, 0, _RAW_MUTEX_LOCKED, order: .acquire, loadOrder: .relaxed) != 0 {
+            _acquireSlow(ptr)
+        }
+    }
+
+    @inlinable
+    public static func release(_ ptr: Pointer) {
+        if AtomicUInt8.compareExchange(ptr, _RAW_MUTEX_LOCKED, 0, order: .release, loadOrder: .relaxed) != _RAW_MUTEX_LOCKED {
+            _releaseSlow(ptr, fair: false)
+        }
+    }
+
+    @inlinable
+    public static func releaseFair(_ ptr: Pointer) {
+        if AtomicUInt8.compareExchange(ptr, _RAW_MUTEX_LOCKED, 0, order: .release, loadOrder: .relaxed) != _RAW_MUTEX_LOCKED {
+            _releaseSlow(ptr, fair: true)
+        }
+    }
+
+    @usableFromInline
+    @inline(never)
+    static func _acquireSlow(_ ptr: Pointer) {
+        var backoff = Backoff()
+        var spins = 0
+        var state = AtomicUInt8.load(ptr, order: .relaxed)
+        while true {
+            // Grab the lock if it isn't locked, even if there are other
+            // threads parked.
+            if state & _RAW_MUTEX_LOCKED == 0 {
+                if AtomicUInt8.compareExchangeWeak(ptr, &state, state | _RAW_MUTEX_LOCKED, order: .acquire, loadOrder: .relaxed) {
+                    return
+                }
+                continue
+            }
+
+            // If there is no queue, try spinning a few times.
+            if state & _RAW_MUTEX_PARKED == 0, spins < _RAW_MUTEX_MAX_SPINS {
+                spins += 1
+                backoff.snooze()
+                state = AtomicUInt8.load(ptr, order: .relaxed)
+                continue
+            }
+
+            // Set the parked bit.
+            if state & _RAW_MUTEX_PARKED == 0 {
+                if !AtomicUInt8.compareExchangeWeak(ptr, &state, state | _RAW_MUTEX_PARKED, order: .relaxed, loadOrder: .relaxed) {
+                    continue
+                }
+            }
+
+            // Park our thread until we are woken up by an unlock.
+            let result = ParkingLot.park(
+                address: ptr,
+                validate: {
+                    AtomicUInt8.load(ptr, order: .relaxed) == _RAW_MUTEX_LOCKED | _RAW_MUTEX_PARKED
+                }
+            )
+
+            // The lock was handed off to us directly; we now own it.
+            if result == .unparked(_RAW_MUTEX_HANDOFF) {
+                return
+            }
+
+            // Loop back and try locking again.
+            backoff = Backoff()
+            spins = 0
+            state = AtomicUInt8.load(ptr, order: .relaxed)
+        }
+    }
+
+    @usableFromInline
+    @inline(never)
+    static func _releaseSlow(_ ptr: Pointer, fair: Bool) {
+        // Unpark one thread and leave the parked bit set if there might
+        // still be parked threads on this address.
+        ParkingLot.unparkOne(address: ptr) { result in
+            if fair, result.unparkedThreads != 0 {
+                // Hand off the lock directly to the unparked thread,
+                // without unlocking it.
+                if !result.haveMoreThreads {
+                    AtomicUInt8.store(ptr, _RAW_MUTEX_LOCKED, order: .relaxed)
+                }
+                return _RAW_MUTEX_HANDOFF
+            }
+            AtomicUInt8.store(
+                ptr,
+                result.haveMoreThreads ? _RAW_MUTEX_PARKED : 0,
+                order: .release
+            )
+            return ParkingLot.DEFAULT_UNPARK_TOKEN
+        }
+    }
+}
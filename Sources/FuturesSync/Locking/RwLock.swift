@@ -0,0 +1,110 @@
+//
+//  RwLock.swift
+//  Futures
+//
+//  Copyright © 2019 Akis Kesoglou. Licensed under the MIT license.
+//
+
+/// A reader-writer lock optimized for read-mostly workloads.
+///
+/// Readers announce themselves by incrementing one of several counters,
+/// each on its own cache line, chosen by the current thread. As long as
+/// there is no writer, acquiring and releasing the lock for reading touches
+/// only that cache line, so readers on different processors do not contend
+/// with each other and read throughput scales with the number of processors.
+///
+/// A writer first acquires an internal `RawMutex`, which serializes writers,
+/// and then revokes the readers' fast path by raising a flag, before waiting
+/// for all counters to drain. Readers that find the flag raised back off and
+/// wait for the writer by acquiring the same mutex. Writers are therefore
+/// comparatively expensive; their cost grows with the number of counters.
+///
+/// The lock is not recursive; a thread that holds it in either mode must
+/// not attempt to acquire it again.
+public final class RwLock: ReadWriteLockingProtocol {
+    @usableFromInline let _readers: StripedCounter
+    @usableFromInline let _mutex = RawMutex()
+    @usableFromInline var _writer: AtomicBool.RawValue = false
+
+    /// Creates a lock.
+    ///
+    /// - Parameter stripes: The number of reader counters. Must be a power
+    ///     of 2. Defaults to the smallest power of 2 not less than the number
+    ///     of processors.
+    @inlinable
+    public init(stripes: Int = StripedCounter.defaultStripes) {
+        _readers = StripedCounter(stripes: stripes)
+        AtomicBool.initialize(&_writer, to: false)
+    }
+
+    // MARK: Shared
+
+    @inlinable
+    public func tryAcquireShared() -> Bool {
+        _readers.increment()
+        // Pairs with the fence in `_revokeReaders()`; either the writer sees
+        // our increment, or we see its flag.
+        Atomic.threadFence()
+        if !AtomicBool.load(&_writer, order: .acquire) {
+            return true
+        }
+        releaseShared()
+        return false
+    }
+
+    @inlinable
+    public func acquireShared() {
+        while !tryAcquireShared() {
+            // Wait for the writer to finish.
+            _mutex.acquire()
+            _mutex.release()
+        }
+    }
+
+    @inlinable
+    public func releaseShared() {
+        Atomic.threadFence(order: .release)
+        _readers.decrement()
+    }
+
+    // MARK: Exclusive
+
+    @inlinable
+    public func tryAcquire() -> Bool {
+        guard _mutex.tryAcquire() else {
+            return false
+        }
+        AtomicBool.store(&_writer, true, order: .relaxed)
+        Atomic.threadFence()
+        if _readers.sum == 0 {
+            Atomic.threadFence(order: .acquire)
+            return true
+        }
+        release()
+        return false
+    }
+
+    @inlinable
+    public func acquire() {
+        _mutex.acquire()
+        _revokeReaders()
+    }
+
+    @inlinable
+    public func release() {
+        AtomicBool.store(&_writer, false, order: .release)
+        _mutex.release()
+    }
+
+    @usableFromInline
+    func _revokeReaders() {
+        AtomicBool.store(&_writer, true, order: .relaxed)
+        Atomic.threadFence()
+        var backoff = Backoff()
+        while _readers.sum != 0 {
+            backoff.snooze()
+        }
+        // Synchronize with the release fences of departing readers.
+        Atomic.threadFence(order: .acquire)
+    }
+}
@@ -5,6 +5,8 @@
 //  Copyright © 2019 Akis Kesoglou. Licensed under the MIT license.
 //
 
+@usableFromInline let _spinLockBackoffSite = Backoff.Site("SpinLock.acquire")
+
 // Prefer UnfairLock over this guy on Darwin;
 // it's equally performant but safer.
 public final class SpinLock: LockingProtocol {
@@ -22,12 +24,20 @@ public final class SpinLock: LockingProtocol {
 
     @inlinable
     public func acquire() {
-        var backoff = Backoff()
-        while AtomicBool.compareExchangeWeak(&_flag, false, true, order: .acquire) {
-            backoff.snooze()
+        if AtomicBool.compareExchangeWeak(&_flag, false, true, order: .acquire) {
+            _acquireContended()
         }
     }
 
+    @usableFromInline
+    func _acquireContended() {
+        var backoff = Backoff(site: _spinLockBackoffSite)
+        repeat {
+            backoff.snooze()
+        } while AtomicBool.compareExchangeWeak(&_flag, false, true, order: .acquire)
+        backoff.finish()
+    }
+
     @inlinable
     public func release() {
         AtomicBool.store(&_flag, false, order: .release)
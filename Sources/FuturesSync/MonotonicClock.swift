@@ -0,0 +1,163 @@
+//
+//  MonotonicClock.swift
+//  Futures
+//
+//  Copyright © 2019 Akis Kesoglou. Licensed under the MIT license.
+//
+
+import FuturesPrivate
+
+/// A source of monotonic time, for instrumentation, timers and deadline
+/// checks.
+///
+/// All sources report nanoseconds since the same arbitrary point in the
+/// past, so readings from different sources can be compared, within the
+/// resolution of the coarser of the two.
+///
+///     let start = MonotonicClock.cycles.now()
+///     work()
+///     let elapsed = MonotonicClock.cycles.now() - start
+///
+/// Code that runs on an executor and only needs to know roughly when it
+/// runs, such as tracing or expiring deadlines, should prefer `tickTime`,
+/// which costs no more than reading a thread-local variable.
+public enum MonotonicClock {
+    /// The system monotonic clock; `CLOCK_MONOTONIC` on Linux and
+    /// `CLOCK_UPTIME_RAW` on Darwin. Precise, but reading it costs a few tens
+    /// of nanoseconds.
+    case monotonic
+
+    /// The coarse system monotonic clock; `CLOCK_MONOTONIC_COARSE` on Linux
+    /// and `CLOCK_UPTIME_RAW_APPROX` on Darwin. Only a few nanoseconds to
+    /// read, but only updated every few milliseconds; see `coarseResolution`.
+    case coarse
+
+    /// The processor's cycle counter; the time stamp counter on x86 and the
+    /// virtual counter on ARM64, converted to nanoseconds. The counter is
+    /// calibrated against `monotonic` the first time it is read, unless the
+    /// processor reports its frequency. Falls back to `monotonic` on other
+    /// processors, or if the counter does not appear to be running.
+    case cycles
+
+    /// Returns the current time of the clock, in nanoseconds.
+    @inlinable
+    public func now() -> UInt64 {
+        switch self {
+        case .monotonic:
+            return CClockMonotonic()
+        case .coarse:
+            return CClockMonotonicCoarse()
+        case .cycles:
+            return _cycleClock.nanoseconds(CClockCycles())
+        }
+    }
+
+    /// The resolution of the `coarse` clock, in nanoseconds.
+    public static var coarseResolution: UInt64 {
+        return CClockMonotonicCoarseResolution()
+    }
+
+    // MARK: Tick time
+
+    /// The `monotonic` time, in nanoseconds, at which the current thread's
+    /// executor started its current tick.
+    ///
+    /// Executors refresh the tick time once per tick, so code that runs on
+    /// an executor can read it at no cost. Outside of an executor, the tick
+    /// time may be arbitrarily stale; it is refreshed on first read on each
+    /// thread.
+    @inlinable
+    public static var tickTime: UInt64 {
+        let time = CThreadRuntimeGetCurrent().pointee.tickTime
+        if _fastPath(time != 0) {
+            return time
+        }
+        return refreshTickTime()
+    }
+
+    /// Sets the tick time of the current thread to the current `monotonic`
+    /// time and returns it. Called by executors at the start of each tick.
+    @inlinable
+    @discardableResult
+    public static func refreshTickTime() -> UInt64 {
+        let time = CClockMonotonic()
+        CThreadRuntimeGetCurrent().pointee.tickTime = time
+        return time
+    }
+}
+
+// MARK: - Private -
+
+/// The length of the interval over which the cycle counter is calibrated,
+/// when the processor does not report its frequency.
+private let _CALIBRATION_NANOSECONDS: UInt64 = 1_000_000
+
+/// Converts cycle counter readings to nanoseconds since the origin of the
+/// monotonic clock.
+@usableFromInline
+struct _CycleClock {
+    @usableFromInline let baseCycles: UInt64
+    @usableFromInline let baseNanoseconds: UInt64
+
+    // nanoseconds per cycle, as a 32.32 fixed-point number;
+    // 0 if the counter is unusable
+    @usableFromInline let multiplier: UInt64
+
+    init() {
+        guard CClockHasCycleCounter() else {
+            self.init(cycles: 0, nanoseconds: 0, multiplier: 0)
+            return
+        }
+        let (cycles0, nanoseconds0) = _CycleClock._sample()
+        let frequency = CClockCycleFrequency()
+        if frequency != 0 {
+            // 1e9 << 32 overflows 64 bits
+            let ns = UInt64(1_000_000_000).multipliedFullWidth(by: 1 << 32)
+            let multiplier = frequency.dividingFullWidth(ns).quotient
+            self.init(cycles: cycles0, nanoseconds: nanoseconds0, multiplier: multiplier)
+            return
+        }
+        var (cycles1, nanoseconds1) = _CycleClock._sample()
+        while nanoseconds1 &- nanoseconds0 < _CALIBRATION_NANOSECONDS {
+            (cycles1, nanoseconds1) = _CycleClock._sample()
+        }
+        guard cycles1 > cycles0 else {
+            self.init(cycles: 0, nanoseconds: 0, multiplier: 0)
+            return
+        }
+        let multiplier = ((nanoseconds1 - nanoseconds0) << 32) / (cycles1 - cycles0)
+        self.init(cycles: cycles0, nanoseconds: nanoseconds0, multiplier: multiplier)
+    }
+
+    init(cycles: UInt64, nanoseconds: UInt64, multiplier: UInt64) {
+        baseCycles = cycles
+        baseNanoseconds = nanoseconds
+        self.multiplier = multiplier
+    }
+
+    @inlinable
+    @inline(__always)
+    func nanoseconds(_ cycles: UInt64) -> UInt64 {
+        if _slowPath(multiplier == 0) {
+            return CClockMonotonic()
+        }
+        // The counter may be slightly out of sync between processors.
+        let delta = cycles &- baseCycles
+        if _slowPath(Int64(bitPattern: delta) < 0) {
+            return baseNanoseconds
+        }
+        let (high, low) = delta.multipliedFullWidth(by: multiplier)
+        return baseNanoseconds &+ (high << 32 | low >> 32)
+    }
+
+    /// Reads the cycle counter and the monotonic clock at about the same
+    /// time.
+    private static func _sample() -> (cycles: UInt64, nanoseconds: UInt64) {
+        let before = CClockCycles()
+        let nanoseconds = CClockMonotonic()
+        let after = CClockCycles()
+        return (before / 2 + after / 2, nanoseconds)
+    }
+}
+
+@usableFromInline let _cycleClock = _CycleClock()
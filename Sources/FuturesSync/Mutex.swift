@@ -88,3 +88,15 @@ extension Mutex where Lock == UnfairLock {
         self.init(value, lock: .init())
     }
 }
+
+extension Mutex where Lock: ReadWriteLockingProtocol {
+    /// Invokes `fn` with the value while holding the lock for reading,
+    /// allowing other readers to access the value concurrently.
+    @inlinable
+    @inline(__always)
+    public func withValue<R>(_ fn: (Value) throws -> R) rethrows -> R {
+        return try _lock.syncShared {
+            try fn(_value)
+        }
+    }
+}
@@ -0,0 +1,283 @@
+//
+//  ParkingLot.swift
+//  Futures
+//
+//  Copyright © 2019 Akis Kesoglou. Licensed under the MIT license.
+//
+
+// This is a simplified port of parking_lot: https://github.com/Amanieu/parking_lot
+// which in turn is based on WebKit's WTF::ParkingLot.
+
+#if canImport(Darwin)
+import Darwin.POSIX.pthread
+#else
+import Glibc
+#endif
+
+/// A global table of thread queues, keyed by memory address.
+///
+/// The parking lot allows any memory location to be used as a place for
+/// threads to wait on, without the location itself having to hold anything
+/// but the few bits that describe its state. This makes it possible to
+/// build synchronization primitives, such as `RawMutex` and `RawCondvar`,
+/// that occupy a single byte at rest and only need the table when a thread
+/// actually has to block.
+///
+/// Threads are parked and unparked in FIFO order per address. Parking and
+/// unparking a given address is serialized by a lock protecting the bucket
+/// the address hashes to, which is also held while invoking the callbacks
+/// passed to `park(address:validate:beforeSleep:timedOut:deadline:)` and
+/// `unparkOne(address:callback:)`. Callbacks must therefore be short and
+/// must not call back into the parking lot.
+public enum ParkingLot {
+    /// A value that is passed from the unparking thread to the thread that
+    /// is unparked.
+    public typealias Token = UInt
+
+    /// The token passed to unparked threads when no other is specified.
+    public static let DEFAULT_UNPARK_TOKEN: Token = 0
+
+    /// The result of parking a thread.
+    public enum ParkResult: Equatable {
+        /// The thread was unparked by another thread with the given token.
+        case unparked(Token)
+
+        /// The validation callback returned `false`; the thread was not
+        /// parked at all.
+        case invalid
+
+        /// The deadline was reached before the thread was unparked.
+        case timedOut
+    }
+
+    /// The result of unparking threads.
+    public struct UnparkResult {
+        /// The number of threads that were unparked.
+        public let unparkedThreads: Int
+
+        /// Whether there are threads still parked on the same address.
+        public let haveMoreThreads: Bool
+    }
+
+    /// Parks the current thread in the queue associated with `address`.
+    ///
+    /// `validate` is invoked while holding the queue lock and can abort the
+    /// operation by returning `false`. Otherwise, the thread is added to the
+    /// queue, the queue lock is released and `beforeSleep` is invoked, just
+    /// before the thread goes to sleep. This is where, for example, a
+    /// condition variable releases its associated mutex.
+    ///
+    /// If `deadline` is reached before the thread is unparked, the thread is
+    /// removed from the queue and `timedOut` is invoked while holding the
+    /// queue lock, passing a boolean that denotes whether this was the last
+    /// thread parked on `address`.
+    ///
+    /// - Parameter deadline: The absolute time, in seconds and nanoseconds
+    ///     since the Unix Epoch, at which to give up waiting; see
+    ///     `PosixConditionLock.wait(until:)`.
+    public static func park(
+        address: UnsafeRawPointer,
+        validate: () -> Bool,
+        beforeSleep: () -> Void = {},
+        timedOut: (_ wasLastThread: Bool) -> Void = { _ in },
+        deadline: timespec? = nil
+    ) -> ParkResult {
+        let key = UInt(bitPattern: address)
+        let thread = _currentThreadData.value
+        let bucket = _bucket(for: key)
+
+        bucket.lock.acquire()
+        guard validate() else {
+            bucket.lock.release()
+            return .invalid
+        }
+        thread.key = key
+        thread.token = DEFAULT_UNPARK_TOKEN
+        thread.parked = true
+        bucket.enqueue(thread)
+        bucket.lock.release()
+
+        beforeSleep()
+
+        if let deadline = deadline, !thread.park(until: deadline) {
+            bucket.lock.acquire()
+            if bucket.remove(thread) {
+                timedOut(!bucket.contains(key: key))
+                bucket.lock.release()
+                return .timedOut
+            }
+            bucket.lock.release()
+            // We were unparked just as we timed out; the unparking thread
+            // is about to wake us up, so wait for it to finish.
+        }
+        thread.park()
+        return .unparked(thread.token)
+    }
+
+    /// Unparks one thread from the queue associated with `address`.
+    ///
+    /// `callback` is invoked while holding the queue lock, whether a thread
+    /// was unparked or not, and the token it returns is passed to the
+    /// unparked thread. This is where, for example, a mutex updates its
+    /// state to reflect whether there are still threads parked on it.
+    @discardableResult
+    public static func unparkOne(
+        address: UnsafeRawPointer,
+        callback: (UnparkResult) -> Token = { _ in DEFAULT_UNPARK_TOKEN }
+    ) -> UnparkResult {
+        let key = UInt(bitPattern: address)
+        let bucket = _bucket(for: key)
+
+        bucket.lock.acquire()
+        let thread = bucket.removeFirst(key: key)
+        let result = UnparkResult(
+            unparkedThreads: thread == nil ? 0 : 1,
+            haveMoreThreads: thread != nil && bucket.contains(key: key)
+        )
+        let token = callback(result)
+        thread?.token = token
+        bucket.lock.release()
+
+        thread?.unpark()
+        return result
+    }
+
+    /// Unparks all threads in the queue associated with `address`.
+    ///
+    /// - Returns: The number of threads that were unparked.
+    @discardableResult
+    public static func unparkAll(address: UnsafeRawPointer, token: Token = DEFAULT_UNPARK_TOKEN) -> Int {
+        let key = UInt(bitPattern: address)
+        let bucket = _bucket(for: key)
+
+        var threads = [_ThreadData]()
+        bucket.lock.acquire()
+        while let thread = bucket.removeFirst(key: key) {
+            thread.token = token
+            threads.append(thread)
+        }
+        bucket.lock.release()
+
+        for thread in threads {
+            thread.unpark()
+        }
+        return threads.count
+    }
+}
+
+// MARK: - Private -
+
+private let _BUCKET_BITS = 10 // 1024 buckets
+
+private let _buckets: [_Bucket] = (0..<(1 << _BUCKET_BITS)).map { _ in _Bucket() }
+
+private let _currentThreadData = ThreadLocal {
+    _ThreadData()
+}
+
+@inline(__always)
+private func _bucket(for key: UInt) -> _Bucket {
+    // Fibonacci hashing
+    let hash = key &* UInt(truncatingIfNeeded: 0x9E37_79B9_7F4A_7C15 as UInt64)
+    return _buckets[Int(bitPattern: hash >> UInt(UInt.bitWidth - _BUCKET_BITS))]
+}
+
+private final class _ThreadData {
+    let cond = PosixConditionLock()
+
+    // protected by `cond`
+    var parked = false
+
+    // protected by the lock of the bucket the thread is queued in
+    var key: UInt = 0
+    var token = ParkingLot.DEFAULT_UNPARK_TOKEN
+    var next: _ThreadData?
+
+    /// Blocks until unparked.
+    func park() {
+        cond.sync {
+            while parked {
+                cond.wait()
+            }
+        }
+    }
+
+    /// Blocks until unparked or `deadline` is reached. Returns `false` if
+    /// the thread timed out.
+    func park(until deadline: timespec) -> Bool {
+        return cond.sync {
+            while parked {
+                if !cond.wait(until: deadline) {
+                    return !parked
+                }
+            }
+            return true
+        }
+    }
+
+    func unpark() {
+        cond.sync {
+            parked = false
+            cond.signal()
+        }
+    }
+}
+
+private final class _Bucket {
+    let lock = UnfairLock()
+
+    // protected by `lock`
+    var head: _ThreadData?
+    var tail: _ThreadData?
+
+    func enqueue(_ thread: _ThreadData) {
+        thread.next = nil
+        if let tail = tail {
+            tail.next = thread
+        } else {
+            head = thread
+        }
+        tail = thread
+    }
+
+    func contains(key: UInt) -> Bool {
+        var current = head
+        while let thread = current {
+            if thread.key == key {
+                return true
+            }
+            current = thread.next
+        }
+        return false
+    }
+
+    func removeFirst(key: UInt) -> _ThreadData? {
+        return _remove { $0.key == key }
+    }
+
+    func remove(_ thread: _ThreadData) -> Bool {
+        return _remove { $0 === thread } != nil
+    }
+
+    private func _remove(where predicate: (_ThreadData) -> Bool) -> _ThreadData? {
+        var prev: _ThreadData?
+        var current = head
+        while let thread = current {
+            if predicate(thread) {
+                if let prev = prev {
+                    prev.next = thread.next
+                } else {
+                    head = thread.next
+                }
+                if tail === thread {
+                    tail = prev
+                }
+                thread.next = nil
+                return thread
+            }
+            prev = thread
+            current = thread.next
+        }
+        return nil
+    }
+}
@@ -5,6 +5,12 @@
 //  Copyright © 2019 Akis Kesoglou. Licensed under the MIT license.
 //
 
+#if canImport(Darwin)
+import Darwin
+#else
+import Glibc
+#endif
+
 @inlinable
 @inline(__always)
 func isPowerOf2(_ n: Int) -> Bool {
@@ -21,3 +27,23 @@ extension Optional {
         return value
     }
 }
+
+// MARK: - Threads -
+
+/// The number of processors currently online.
+@usableFromInline let _CPU_COUNT = max(1, sysconf(Int32(_SC_NPROCESSORS_ONLN)))
+
+// MARK: - Time -
+
+/// Returns the absolute time, suitable for `PosixConditionLock.wait(until:)`,
+/// `nanoseconds` from now.
+func _deadline(afterNanoseconds nanoseconds: Int) -> timespec {
+    var tv = timeval()
+    let rc = gettimeofday(&tv, nil)
+    assert(rc == 0)
+    let nsec = Int(tv.tv_usec) * 1_000 + nanoseconds
+    return timespec(
+        tv_sec: tv.tv_sec + nsec / 1_000_000_000,
+        tv_nsec: nsec % 1_000_000_000
+    )
+}
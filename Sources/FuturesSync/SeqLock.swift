@@ -0,0 +1,164 @@
+//
+//  SeqLock.swift
+//  Futures
+//
+//  Copyright © 2019 Akis Kesoglou. Licensed under the MIT license.
+//
+
+/// A sequence lock protecting a value of a trivially copyable type.
+///
+/// A sequence lock is suitable for small values that are read very often
+/// and written rarely. Writers are serialized and bump a version counter
+/// before and after updating the value. Readers never write to shared
+/// memory; they copy the value out and retry if they observe that a writer
+/// was active in the meantime. Readers therefore never contend with each
+/// other, but may spin while a write is in progress.
+///
+/// The value is stored as a sequence of machine words that are accessed
+/// with relaxed atomic operations, with ordering established via fences, so
+/// concurrent reads and writes are free of data races.
+///
+/// `T` must be a trivially copyable type (i.e. contain no references) with
+/// an alignment no greater than that of `UInt`; these are checked at runtime.
+public final class SeqLock<T> {
+    @usableFromInline var _sequence: AtomicUInt.RawValue = 0
+    @usableFromInline let _words: AtomicUInt.Pointer
+    @usableFromInline let _wordCount: Int
+
+    // Used as the destination of copies when reading. It's never mutated
+    // so it's always safe to read from any thread.
+    @usableFromInline let _template: T
+
+    @inlinable
+    public init(_ value: T) {
+        precondition(_isPOD(T.self), "SeqLock requires a trivially copyable type")
+        precondition(
+            MemoryLayout<T>.alignment <= MemoryLayout<UInt>.alignment,
+            "SeqLock requires a type with at most word alignment"
+        )
+        let wordSize = MemoryLayout<UInt>.size
+        let wordCount = max(1, (MemoryLayout<T>.size + wordSize - 1) / wordSize)
+        _words = .allocate(capacity: wordCount)
+        _words.initialize(repeating: 0, count: wordCount)
+        _wordCount = wordCount
+        _template = value
+        AtomicUInt.initialize(&_sequence, to: 0)
+        _write(value)
+    }
+
+    @inlinable
+    deinit {
+        _words.deinitialize(count: _wordCount)
+        _words.deallocate()
+    }
+
+    /// The current version of the value. Even while no write is in progress,
+    /// odd otherwise.
+    @inlinable
+    public var version: UInt {
+        return AtomicUInt.load(&_sequence, order: .acquire)
+    }
+
+    /// Returns a consistent snapshot of the value, spinning while a write
+    /// is in progress.
+    @inlinable
+    public func load() -> T {
+        var backoff = Backoff()
+        while true {
+            if let value = tryLoad() {
+                return value
+            }
+            backoff.snooze()
+        }
+    }
+
+    /// Attempts to read a consistent snapshot of the value once, returning
+    /// `nil` if a write was in progress.
+    @inlinable
+    public func tryLoad() -> T? {
+        let seq = AtomicUInt.load(&_sequence, order: .acquire)
+        if seq & 1 != 0 {
+            return nil // write in progress
+        }
+        let value = _read()
+        Atomic.threadFence(order: .acquire)
+        if AtomicUInt.load(&_sequence, order: .relaxed) != seq {
+            return nil // value changed while we were reading
+        }
+        return value
+    }
+
+    /// Replaces the value.
+    @inlinable
+    public func store(_ value: T) {
+        update { $0 = value }
+    }
+
+    /// Updates the value in place. Concurrent writers are serialized.
+    @inlinable
+    @discardableResult
+    public func update<R>(_ fn: (inout T) throws -> R) rethrows -> R {
+        var backoff = Backoff()
+        var seq = AtomicUInt.load(&_sequence, order: .relaxed)
+        while true {
+            if seq & 1 == 0, AtomicUInt.compareExchangeWeak(&_sequence, &seq, seq &+ 1, order: .acquire, loadOrder: .relaxed) {
+                break
+            }
+            backoff.snooze()
+            seq = AtomicUInt.load(&_sequence, order: .relaxed)
+        }
+        // Prevent the stores below from being reordered before the
+        // sequence number becomes odd.
+        Atomic.threadFence(order: .release)
+        defer {
+            AtomicUInt.store(&_sequence, seq &+ 2, order: .release)
+        }
+        var value = _read()
+        let result = try fn(&value)
+        _write(value)
+        return result
+    }
+
+    @inlinable
+    @inline(__always)
+    func _read() -> T {
+        var value = _template
+        withUnsafeMutableBytes(of: &value) { bytes in
+            var offset = 0
+            for i in 0..<_wordCount {
+                let count = min(MemoryLayout<UInt>.size, bytes.count - offset)
+                if count == 0 {
+                    break
+                }
+                let word = AtomicUInt.load(_words + i, order: .relaxed)
+                withUnsafeBytes(of: word) {
+                    bytes.baseAddress!.advanced(by: offset).copyMemory(from: $0.baseAddress!, byteCount: count)
+                    // swiftlint:disable:previous force_unwrapping
+                }
+                offset += count
+            }
+        }
+        return value
+    }
+
+    @inlinable
+    @inline(__always)
+    func _write(_ value: T) {
+        withUnsafeBytes(of: value) { bytes in
+            var offset = 0
+            for i in 0..<_wordCount {
+                let count = min(MemoryLayout<UInt>.size, bytes.count - offset)
+                if count == 0 {
+                    break
+                }
+                var word: UInt = 0
+                withUnsafeMutableBytes(of: &word) {
+                    $0.baseAddress!.copyMemory(from: bytes.baseAddress!.advanced(by: offset), byteCount: count)
+                    // swiftlint:disable:previous force_unwrapping
+                }
+                AtomicUInt.store(_words + i, word, order: .relaxed)
+                offset += count
+            }
+        }
+    }
+}
@@ -0,0 +1,105 @@
+//
+//  StripedCounter.swift
+//  Futures
+//
+//  Copyright © 2019 Akis Kesoglou. Licensed under the MIT license.
+//
+
+// Modelled after Java's LongAdder.
+
+// The size of each cell. Larger than a typical cache line, to also keep
+// cells apart on processors that prefetch adjacent lines in pairs.
+@usableFromInline let _STRIPED_COUNTER_CELL_SIZE = 128
+
+/// A counter that can be updated from multiple threads with little
+/// contention.
+///
+/// When many threads update the same atomic integer, the cache line that
+/// holds it keeps bouncing between processors, which quickly dominates
+/// the cost of the update. `StripedCounter` instead spreads updates over
+/// several counters ("cells"), each on its own cache line, with each thread
+/// updating the cell it maps to. Reading the value sums all cells, so it's
+/// comparatively expensive; this makes it a good fit for statistics and
+/// metrics, which are updated far more often than they are read.
+///
+/// Updates are performed with relaxed ordering and the sum is not an atomic
+/// snapshot; concurrent updates may or may not be reflected in it.
+public final class StripedCounter {
+    @usableFromInline let _cells: UnsafeMutableRawPointer
+    @usableFromInline let _mask: Int
+
+    /// Creates a counter with a value of zero.
+    ///
+    /// - Parameter stripes: The number of cells to spread updates over.
+    ///     Must be a power of 2. Defaults to the smallest power of 2 not
+    ///     less than the number of processors.
+    public init(stripes: Int = StripedCounter.defaultStripes) {
+        precondition(stripes > 0 && isPowerOf2(stripes), "stripes must be a power of 2")
+        _cells = .allocate(
+            byteCount: stripes * _STRIPED_COUNTER_CELL_SIZE,
+            alignment: _STRIPED_COUNTER_CELL_SIZE
+        )
+        _cells.bindMemory(
+            to: AtomicInt.RawValue.self,
+            capacity: stripes * _STRIPED_COUNTER_CELL_SIZE / MemoryLayout<AtomicInt.RawValue>.stride
+        )
+        _mask = stripes - 1
+        for i in 0..<stripes {
+            AtomicInt.initialize(_cell(i), to: 0)
+        }
+    }
+
+    deinit {
+        _cells.deallocate()
+    }
+
+    /// The default number of stripes; the smallest power of 2 not less than
+    /// the number of processors.
+    public static let defaultStripes = 1 << (Int.bitWidth - (_CPU_COUNT - 1).leadingZeroBitCount)
+
+    /// The number of cells updates are spread over.
+    public var stripes: Int {
+        return _mask + 1
+    }
+
+    /// Adds `value` to the counter.
+    @inlinable
+    public func increment(by value: Int = 1) {
+        AtomicInt.fetchAdd(_cell(ThreadRuntime.threadIndex & _mask), value, order: .relaxed)
+    }
+
+    /// Subtracts `value` from the counter.
+    @inlinable
+    public func decrement(by value: Int = 1) {
+        AtomicInt.fetchSub(_cell(ThreadRuntime.threadIndex & _mask), value, order: .relaxed)
+    }
+
+    /// The current value of the counter, computed by summing all cells.
+    @inlinable
+    public var sum: Int {
+        var sum = 0
+        for i in 0...(_mask) {
+            sum = sum &+ AtomicInt.load(_cell(i), order: .relaxed)
+        }
+        return sum
+    }
+
+    /// Resets the counter to zero and returns its previous value.
+    /// Concurrent updates are either reflected in the returned value or
+    /// retained in the counter.
+    @inlinable
+    @discardableResult
+    public func reset() -> Int {
+        var sum = 0
+        for i in 0...(_mask) {
+            sum = sum &+ AtomicInt.exchange(_cell(i), 0, order: .relaxed)
+        }
+        return sum
+    }
+
+    @inlinable
+    @inline(__always)
+    func _cell(_ index: Int) -> AtomicInt.Pointer {
+        return (_cells + index &* _STRIPED_COUNTER_CELL_SIZE).assumingMemoryBound(to: AtomicInt.RawValue.self)
+    }
+}
@@ -0,0 +1,232 @@
+//
+//  ThreadRuntime.swift
+//  Futures
+//
+//  Copyright © 2019 Akis Kesoglou. Licensed under the MIT license.
+//
+
+import FuturesPrivate
+
+/// Per-thread state used by the runtime: the current executor, thread and
+/// worker indices, the processor the thread last ran on and per-thread
+/// caches.
+///
+/// Unlike `ThreadLocal`, which goes through `pthread_getspecific()` and a
+/// boxed value on every access, this state lives in native thread-local
+/// storage, so reading it is as cheap as reading a global variable. Native
+/// thread-local storage cannot run destructors, however, so objects stored
+/// here are owned by a `ThreadLocal` that is only accessed the first time
+/// they are needed on each thread, and releases them when the thread exits.
+public enum ThreadRuntime {
+    /// A small integer that identifies the current thread, assigned in the
+    /// order threads first ask for it. Used to spread threads over striped
+    /// data structures.
+    @inlinable
+    public static var threadIndex: Int {
+        let index = CThreadRuntimeGetCurrent().pointee.threadIndex
+        if _fastPath(index >= 0) {
+            return index
+        }
+        return _assignThreadIndex()
+    }
+
+    /// The index of the current thread in the pool that owns it, or `nil`
+    /// if the thread is not a pool worker. Thread pools set this on each of
+    /// their threads when they start.
+    @inlinable
+    public static var workerIndex: Int? {
+        get {
+            let index = CThreadRuntimeGetCurrent().pointee.workerIndex
+            return index < 0 ? nil : index
+        }
+        set {
+            precondition(newValue.map { $0 >= 0 } ?? true, "Worker index must not be negative")
+            CThreadRuntimeGetCurrent().pointee.workerIndex = newValue ?? -1
+        }
+    }
+
+    /// The processor the current thread is running on, or `nil` if the
+    /// platform cannot tell. The thread may migrate to another processor
+    /// at any time, so the result is only a hint.
+    @inlinable
+    public static var currentCPU: Int? {
+        let cpu = CThreadRuntimeGetCPU()
+        CThreadRuntimeGetCurrent().pointee.cpu = cpu
+        return cpu < 0 ? nil : Int(cpu)
+    }
+
+    /// The processor the current thread was running on the last time
+    /// `currentCPU` was read on it, or `nil` if never or unknown. Cheaper
+    /// than `currentCPU`, but potentially more stale.
+    @inlinable
+    public static var lastCPU: Int? {
+        let cpu = CThreadRuntimeGetCurrent().pointee.cpu
+        return cpu < 0 ? nil : Int(cpu)
+    }
+
+    /// Returns the current thread's executor, creating it with `makeExecutor`
+    /// on first access.
+    ///
+    /// The slot is meant for a single executor type; it is used by
+    /// `ThreadExecutor.current`. The executor is retained until the thread
+    /// exits.
+    ///
+    /// - Precondition: The current thread's executor, if any, must be of
+    ///     type `T`.
+    @inlinable
+    public static func executor<T: AnyObject>(_ type: T.Type, default makeExecutor: () -> T) -> T {
+        let runtime = CThreadRuntimeGetCurrent()
+        if let ptr = runtime.pointee.executor {
+            guard runtime.pointee.executorType == _typeID(T.self) else {
+                preconditionFailure("The current thread's executor is not of type \(T.self)")
+            }
+            return Unmanaged<T>.fromOpaque(ptr).takeUnretainedValue()
+        }
+        let executor = makeExecutor()
+        _setExecutor(executor, type: _typeID(T.self))
+        return executor
+    }
+
+    /// Returns the current thread's cache of type `T`, creating it with
+    /// `makeCache` on first access.
+    ///
+    /// There is one slot per cache type, so callers that need a cache per
+    /// specialization of a generic type should use a type nested in it. The
+    /// cache is retained until the thread exits.
+    @inlinable
+    public static func cache<T: AnyObject>(_ type: T.Type, default makeCache: () -> T) -> T {
+        let caches = _caches
+        let id = _typeID(T.self)
+        if let cache = caches.get(id) {
+            return unsafeDowncast(cache, to: T.self)
+        }
+        let cache = makeCache()
+        caches.insert(cache, for: id)
+        return cache
+    }
+
+    // MARK: Private
+
+    @usableFromInline
+    static func _assignThreadIndex() -> Int {
+        let index = _nextThreadIndex.fetchAdd(1, order: .relaxed)
+        CThreadRuntimeGetCurrent().pointee.threadIndex = index
+        return index
+    }
+
+    @usableFromInline
+    static func _setExecutor(_ executor: AnyObject, type: UInt) {
+        _currentStorage.value.executor = executor
+        let runtime = CThreadRuntimeGetCurrent()
+        runtime.pointee.executor = Unmanaged.passUnretained(executor).toOpaque()
+        runtime.pointee.executorType = type
+    }
+
+    @inlinable
+    @inline(__always)
+    static func _typeID(_ type: AnyObject.Type) -> UInt {
+        return UInt(bitPattern: ObjectIdentifier(type))
+    }
+
+    /// The caches of the current thread, without those of owners that have
+    /// been deallocated.
+    @usableFromInline
+    static var _caches: _ThreadCaches {
+        if let ptr = CThreadRuntimeGetCurrent().pointee.caches {
+            let caches = Unmanaged<_ThreadCaches>.fromOpaque(ptr).takeUnretainedValue()
+            caches.prune()
+            return caches
+        }
+        let caches = _currentStorage.value.caches
+        CThreadRuntimeGetCurrent().pointee.caches = Unmanaged.passUnretained(caches).toOpaque()
+        return caches
+    }
+}
+
+/// Per-thread caches, one for each owner that has used them. There are
+/// typically only a few owners, so a linear scan is cheaper than hashing.
+///
+/// Owners are identified either by a type, via the address of its metadata,
+/// or by a small integer assigned by the owner (e.g. a pool ID); the two
+/// never collide. Caches of types live until the thread exits. Caches of
+/// owner objects are dropped by each thread the next time it accesses its
+/// caches after the owner calls `ownerDidDeinit()`.
+@usableFromInline
+final class _ThreadCaches {
+    @usableFromInline var ids = [UInt]()
+    @usableFromInline var caches = [AnyObject]()
+    var owners = [_CacheOwner]()
+    var generation: UInt = 0
+
+    @inlinable
+    @inline(__always)
+    func get(_ id: UInt) -> AnyObject? {
+        for i in ids.indices where ids[i] == id {
+            return caches[i]
+        }
+        return nil
+    }
+
+    @usableFromInline
+    func insert(_ cache: AnyObject, for id: UInt, owner: AnyObject? = nil) {
+        ids.append(id)
+        caches.append(cache)
+        owners.append(.init(object: owner, isObject: owner != nil))
+    }
+
+    /// Drops the caches of owners that have been deallocated, if any owner
+    /// has been deallocated since the last call.
+    @inline(__always)
+    func prune() {
+        let current = _ownerDeinits.load(order: .acquire)
+        if _slowPath(current != generation) {
+            generation = current
+            _prune()
+        }
+    }
+
+    /// Called by owner objects as they're deallocated, so that all threads
+    /// drop the caches they keep for them.
+    static func ownerDidDeinit() {
+        _ownerDeinits.fetchAdd(1, order: .release)
+    }
+
+    private func _prune() {
+        for i in ids.indices.reversed() where owners[i].isObject && owners[i].object == nil {
+            ids.remove(at: i)
+            caches.remove(at: i)
+            owners.remove(at: i)
+        }
+    }
+}
+
+struct _CacheOwner {
+    weak var object: AnyObject?
+    let isObject: Bool
+}
+
+// MARK: - Private -
+
+private let _nextThreadIndex = AtomicInt(0)
+
+/// The number of times a cache owner has been deallocated.
+private let _ownerDeinits = AtomicUInt(0)
+
+/// Owns the objects referenced by the native thread-local state of a thread.
+private final class _ThreadRuntimeStorage {
+    var executor: AnyObject?
+    let caches = _ThreadCaches()
+
+    deinit {
+        // Runs on the exiting thread, from the `ThreadLocal` destructor;
+        // clear the unretained references before the objects go away.
+        let runtime = CThreadRuntimeGetCurrent()
+        runtime.pointee.executor = nil
+        runtime.pointee.executorType = 0
+        runtime.pointee.caches = nil
+    }
+}
+
+private let _currentStorage = ThreadLocal {
+    _ThreadRuntimeStorage()
+}
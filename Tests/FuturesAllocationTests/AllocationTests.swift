@@ -0,0 +1,239 @@
+//
+//  AllocationTests.swift
+//  Futures
+//
+//  Copyright © 2019 Akis Kesoglou. Licensed under the MIT license.
+//
+
+import Futures
+import FuturesAllocationCounter
+import FuturesTestSupport
+import XCTest
+
+// Budgets are the maximum average number of heap allocations per iteration,
+// after a warm-up that lets caches and reusable storage reach a steady state.
+// Counting is only available in builds without sanitizers; run these tests
+// with `make test-nosanitize`.
+
+private let WARMUP_ITERATIONS = 100
+
+private enum AllocationBudget {
+    /// A budget set from the count measured by `make test-nosanitize`.
+    case measured(Double)
+}
+
+extension XCTestCase {
+    fileprivate func assertAllocations(
+        _ budget: AllocationBudget,
+        iterations: Int = 1_000,
+        file: StaticString = #file,
+        line: UInt = #line,
+        _ body: () throws -> Void
+    ) rethrows {
+        guard let perIteration = try measureAllocations(iterations: iterations, body) else {
+            return
+        }
+        switch budget {
+        case .measured(let budget):
+            XCTAssertLessThanOrEqual(
+                perIteration,
+                budget,
+                "allocations per iteration over budget",
+                file: file,
+                line: line
+            )
+        }
+    }
+
+    /// Returns the average number of heap allocations per iteration, or
+    /// `nil` if counting is not available.
+    fileprivate func measureAllocations(iterations: Int = 1_000, _ body: () throws -> Void) rethrows -> Double? {
+        guard FuturesAllocationCounterIsAvailable() else {
+            return nil
+        }
+        for _ in 0..<WARMUP_ITERATIONS {
+            try body()
+        }
+        FuturesAllocationCounterStart()
+        do {
+            for _ in 0..<iterations {
+                try body()
+            }
+        } catch {
+            _ = FuturesAllocationCounterStop()
+            throw error
+        }
+        let counts = FuturesAllocationCounterStop()
+        return Double(counts.allocations) / Double(iterations)
+    }
+}
+
+// MARK: - Channels -
+
+final class ChannelAllocationTests: XCTestCase {
+    func testUnbuffered() {
+        _testSendReceive(Channel.makeUnbuffered(), budget: .measured(0))
+    }
+
+    func testPassthrough() {
+        _testSendReceive(Channel.makePassthrough(), budget: .measured(0))
+    }
+
+    func testBuffered() {
+        _testSendReceive(Channel.makeBuffered(capacity: 8), budget: .measured(0))
+    }
+
+    func testBufferedUnbounded() {
+        _testSendReceive(Channel.makeBuffered(), budget: .measured(0))
+    }
+
+    func testShared() {
+        _testSendReceive(Channel.makeShared(capacity: 8), budget: .measured(0))
+    }
+
+    func testSharedUnbounded() {
+        // one queue node per item
+        _testSendReceive(Channel.makeShared(), budget: .measured(1))
+    }
+
+    private func _testSendReceive<C: ChannelProtocol>(
+        _ pipe: Channel.Pipe<C>,
+        budget: AllocationBudget,
+        file: StaticString = #file,
+        line: UInt = #line
+    ) where C.Buffer.Item == Int {
+        let (rx, tx) = pipe.split()
+        var sent = 0
+        var received = 0
+        poll { context in
+            self.assertAllocations(budget, file: file, line: line) {
+                if case .ready(.success) = tx.pollSend(&context, 1) {
+                    sent += 1
+                }
+                if case .ready(.some(let item)) = rx.pollNext(&context) {
+                    received += item
+                }
+            }
+            return .ready(())
+        }
+        XCTAssertEqual(received, sent, file: file, line: line)
+    }
+}
+
+// MARK: - Executors -
+
+final class ExecutorAllocationTests: XCTestCase {
+    func testSpawn() throws {
+        // the task and its shared state, plus the cost of submitting
+        let executor = ThreadExecutor()
+        try assertAllocations(.measured(5)) {
+            let task = try executor.spawn(Future.ready())
+            executor.run()
+            _ = task
+        }
+    }
+
+    func testSubmit() throws {
+        // small futures are erased inline, and the incoming queue's storage
+        // and scheduler nodes are reused
+        let executor = ThreadExecutor()
+        try assertAllocations(.measured(0)) {
+            try executor.submit(Future.ready())
+            executor.run()
+        }
+    }
+}
+
+// MARK: - Combinators -
+
+final class CombinatorAllocationTests: XCTestCase {
+    func testJoinAll() {
+        // scheduler nodes are recycled through the thread's free list;
+        // only the scheduler itself and the results are allocated
+        let futures = (0..<64).map { Future.ready($0) }
+        poll { context in
+            self.assertAllocations(.measured(10), iterations: 100) {
+                var f = Future.joinAll(futures)
+                _ = f.poll(&context)
+            }
+            return .ready(())
+        }
+    }
+
+    func testMergeAll() {
+        // scheduler nodes are recycled through the thread's free list;
+        // only the scheduler itself is allocated
+        let streams = (0..<64).map { Stream.just($0) }
+        poll { context in
+            self.assertAllocations(.measured(10), iterations: 100) {
+                let s = Stream.mergeAll(streams)
+                while case .ready(.some) = s.pollNext(&context) {}
+            }
+            return .ready(())
+        }
+    }
+
+    func testJoinAllAllocatesNoNodes() {
+        // a scheduler node per future would make the larger join allocate
+        // more; with nodes recycled, both allocate the same
+        poll { context in
+            let counts = [1, 64].map { count -> Double? in
+                let futures = (0..<count).map { Future.ready($0) }
+                return self.measureAllocations(iterations: 100) {
+                    var f = Future.joinAll(futures)
+                    _ = f.poll(&context)
+                }
+            }
+            if let small = counts[0], let large = counts[1] {
+                XCTAssertLessThanOrEqual(large, small)
+            }
+            return .ready(())
+        }
+    }
+
+    func testMergeAllAllocatesNoNodes() {
+        poll { context in
+            let counts = [1, 64].map { count -> Double? in
+                let streams = (0..<count).map { Stream.just($0) }
+                return self.measureAllocations(iterations: 100) {
+                    let s = Stream.mergeAll(streams)
+                    while case .ready(.some) = s.pollNext(&context) {}
+                }
+            }
+            if let small = counts[0], let large = counts[1] {
+                XCTAssertLessThanOrEqual(large, small)
+            }
+            return .ready(())
+        }
+    }
+
+    func testMergeAllSteadyState() {
+        // scheduler nodes are reused for every element
+        poll { context in
+            let s = Stream.mergeAll((0..<4).map { _ in Stream.sequence(0...) })
+            self.assertAllocations(.measured(0)) {
+                _ = s.pollNext(&context)
+            }
+            return .ready(())
+        }
+    }
+
+    func testMulticast() {
+        _testMulticast(replay: .none)
+        _testMulticast(replay: .latest)
+        _testMulticast(replay: .last(8))
+    }
+
+    private func _testMulticast(replay: Stream.ReplayStrategy, file: StaticString = #file, line: UInt = #line) {
+        poll { context in
+            let stream = Stream.sequence(0...).multicast(replay: replay)
+            let receivers = (0..<4).map { _ in stream.makeStream() }
+            self.assertAllocations(.measured(0), file: file, line: line) {
+                for receiver in receivers {
+                    _ = receiver.pollNext(&context)
+                }
+            }
+            return .ready(())
+        }
+    }
+}
@@ -0,0 +1,170 @@
+//
+//  AtomicObjectPoolTests.swift
+//  Futures
+//
+//  Copyright © 2019 Akis Kesoglou. Licensed under the MIT license.
+//
+
+import Foundation
+import FuturesSync
+import FuturesTestSupport
+import XCTest
+
+private final class Node {
+    var value = 0
+}
+
+final class AtomicObjectPoolTests: XCTestCase {
+    func testReuse() {
+        let pool = AtomicObjectPool(magazineSize: 4) { Node() }
+        let a = pool.get()
+        XCTAssertEqual(pool.misses, 1)
+        pool.put(a)
+        XCTAssert(pool.get() === a)
+        XCTAssertEqual(pool.hits, 1)
+    }
+
+    func testDepot() {
+        let pool = AtomicObjectPool(maxRetained: 8, magazineSize: 4) { Node() }
+        let nodes = (0..<20).map { _ in pool.get() }
+        XCTAssertEqual(pool.misses, 20)
+
+        // Return objects on another thread; 8 are cached by that thread and
+        // 8 are moved to the depot. The rest are dropped.
+        let q = DispatchQueue(label: "futures.test-object-pool")
+        let g = DispatchGroup()
+        q.async(group: g) {
+            nodes.forEach(pool.put)
+        }
+        g.wait()
+
+        // Objects in the depot are available to other threads.
+        var reused = Set<ObjectIdentifier>()
+        for _ in 0..<8 {
+            reused.insert(ObjectIdentifier(pool.get()))
+        }
+        XCTAssertEqual(pool.hits, 8)
+        XCTAssertEqual(reused.count, 8)
+        XCTAssert(reused.isSubset(of: nodes.map(ObjectIdentifier.init)))
+
+        _ = pool.get()
+        XCTAssertEqual(pool.misses, 21)
+    }
+
+    func testDoesNotLeak() {
+        weak var weakNode: Node?
+        ({
+            let pool = AtomicObjectPool(maxRetained: 0, magazineSize: 1) { Node() }
+            let nodes = (0..<4).map { _ in pool.get() }
+            weakNode = nodes[0]
+            nodes.forEach(pool.put)
+        })()
+        XCTAssertNil(weakNode)
+    }
+
+    func testDeinitReleasesObjectsCachedByOtherThreads() {
+        weak var weakNode: Node?
+        weak var weakOtherNode: Node?
+        let worker = Worker()
+        defer { worker.stop() }
+        ({
+            let pool = AtomicObjectPool(magazineSize: 4) { Node() }
+            let node = pool.get()
+            weakNode = node
+            pool.put(node)
+            worker.sync {
+                let node = pool.get()
+                weakOtherNode = node
+                pool.put(node)
+            }
+        })()
+        XCTAssertNotNil(weakOtherNode)
+
+        // Both threads drop the caches of the deallocated pool the next
+        // time they use a pool.
+        let pool = AtomicObjectPool { Node() }
+        pool.put(pool.get())
+        worker.sync {
+            pool.put(pool.get())
+        }
+        XCTAssertNil(weakNode)
+        XCTAssertNil(weakOtherNode)
+    }
+
+    func testConcurrentRecycling() {
+        let iterations = 10_000
+        let pool = AtomicObjectPool(maxRetained: 256, magazineSize: 8) { Node() }
+        let q = DispatchQueue(label: "futures.test-object-pool.concurrent", attributes: .concurrent)
+        let g = DispatchGroup()
+        let queue = AtomicMPMCQueue<Node>(capacity: 1024)
+
+        for _ in 0..<CPU_COUNT {
+            // Allocate on one thread...
+            q.async(group: g, flags: .detached) {
+                for _ in 0..<iterations {
+                    let node = pool.get()
+                    XCTAssertEqual(node.value, 0)
+                    node.value = 1
+                    while !queue.tryPush(node) {
+                        Atomic.preemptionYield(0)
+                    }
+                }
+            }
+            // ...and recycle on another.
+            q.async(group: g, flags: .detached) {
+                var count = 0
+                while count < iterations {
+                    if let node = queue.pop() {
+                        node.value = 0
+                        pool.put(node)
+                        count += 1
+                    }
+                }
+            }
+        }
+        g.wait()
+
+        XCTAssertEqual(pool.hits + pool.misses, CPU_COUNT * iterations)
+        XCTAssertGreaterThan(pool.hits, 0)
+    }
+}
+
+/// A thread that keeps running until stopped, so that its thread-local state
+/// outlives the work it's given.
+private final class Worker {
+    private var _work: (() -> Void)?
+    private var _isStopped = false
+    private let _start = DispatchSemaphore(value: 0)
+    private let _done = DispatchSemaphore(value: 0)
+
+    init() {
+        let thread = Thread { [unowned self] in
+            while true {
+                self._start.wait()
+                if self._isStopped {
+                    self._done.signal()
+                    return
+                }
+                // Release the closure before signalling, so that objects it
+                // captures don't outlive the call to `sync`.
+                self._work?()
+                self._work = nil
+                self._done.signal()
+            }
+        }
+        thread.start()
+    }
+
+    /// Runs `work` on the thread and waits for it to return.
+    func sync(_ work: @escaping () -> Void) {
+        _work = work
+        _start.signal()
+        _done.wait()
+    }
+
+    func stop() {
+        _isStopped = true
+        _start.signal()
+        _done.wait()
+    }
+}
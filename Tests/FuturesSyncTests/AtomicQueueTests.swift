@@ -192,6 +192,85 @@ final class AtomicUnboundedMPSCQueueTests: XCTestCase {
     func testConcurrent() { tester.testConcurrent() }
 }
 
+final class AtomicUnboundedMPMCQueueTests: XCTestCase {
+    private let tester = UnboundedQueueTester(
+        supportsMultipleProducers: true,
+        supportsMultipleConsumers: true,
+        constructor: AtomicUnboundedMPMCQueue<Int>.init
+    )
+
+    func testSync() { tester.testSync() }
+    func testConcurrent() { tester.testConcurrent() }
+
+    func testSegments() {
+        let q = AtomicUnboundedMPMCQueue<Int>()
+        XCTAssert(q.isEmpty)
+        for i in 0..<1_000 {
+            q.push(i)
+        }
+        XCTAssertFalse(q.isEmpty)
+        for i in 0..<1_000 {
+            XCTAssertEqual(q.pop(), i)
+        }
+        XCTAssertNil(q.pop())
+        XCTAssert(q.isEmpty)
+    }
+
+    func testDeinitReleasesElements() {
+        final class Object {}
+        weak var first: Object?
+        weak var last: Object?
+        ({
+            let q = AtomicUnboundedMPMCQueue<Object>()
+            let objects = (0..<100).map { _ in Object() }
+            first = objects.first
+            last = objects.last
+            objects.forEach(q.push)
+            _ = q.pop()
+        })()
+        XCTAssertNil(first)
+        XCTAssertNil(last)
+    }
+
+    private func measureThroughput<Q: AtomicQueueProtocol>(_ makeQueue: () -> Q) where Q.Element == Int {
+        let threads = max(2, CPU_COUNT / 2)
+        let perThread = 100_000
+        let producers = DispatchQueue(label: "tests.queue-producer", attributes: .concurrent)
+        let consumers = DispatchQueue(label: "tests.queue-consumer", attributes: .concurrent)
+
+        measure {
+            let q = makeQueue()
+            let popped = AtomicInt(0)
+            let group = DispatchGroup()
+            for _ in 0..<threads {
+                producers.async(group: group, flags: .detached) {
+                    for i in 0..<perThread {
+                        while !q.tryPush(i) {
+                            Atomic.hardwarePause()
+                        }
+                    }
+                }
+                consumers.async(group: group, flags: .detached) {
+                    while popped.load(order: .relaxed) < threads * perThread {
+                        if q.pop() != nil {
+                            popped.fetchAdd(1, order: .relaxed)
+                        }
+                    }
+                }
+            }
+            group.wait()
+        }
+    }
+
+    func testPerformanceUnboundedMPMC() {
+        measureThroughput { AtomicUnboundedMPMCQueue<Int>() }
+    }
+
+    func testPerformanceBoundedMPMC() {
+        measureThroughput { AtomicMPMCQueue<Int>(capacity: 1024) }
+    }
+}
+
 final class AtomicBoundedSPSCQueueTests: XCTestCase {
     private let tester = BoundedQueueTester(
         supportsMultipleProducers: false,
@@ -201,6 +280,81 @@ final class AtomicBoundedSPSCQueueTests: XCTestCase {
 
     func testSync() { tester.testSync() }
     func testConcurrent() { tester.testConcurrent() }
+
+    func testCapacityIsExact() {
+        let q = AtomicSPSCQueue<Int>(capacity: 3)
+        XCTAssertEqual(q.capacity, 3)
+        for i in 0..<10 {
+            XCTAssert(q.tryPush(i))
+            XCTAssert(q.tryPush(i))
+            XCTAssert(q.tryPush(i))
+            XCTAssertFalse(q.tryPush(i))
+            XCTAssertEqual(q.pop(), i)
+            XCTAssertEqual(q.pop(), i)
+            XCTAssertEqual(q.pop(), i)
+            XCTAssertNil(q.pop())
+        }
+    }
+
+    func testBatch() {
+        let q = AtomicSPSCQueue<Int>(capacity: 5)
+        XCTAssertEqual(q.tryPush(contentsOf: 0..<3), 3)
+        XCTAssertEqual(q.tryPush(contentsOf: 3..<10), 2)
+        XCTAssertEqual(q.tryPush(contentsOf: [10]), 0)
+
+        var popped = [Int]()
+        XCTAssertEqual(q.pop(upTo: 2) { popped.append($0) }, 2)
+        XCTAssertEqual(q.tryPush(contentsOf: 5..<10), 2)
+        XCTAssertEqual(q.pop(upTo: 10) { popped.append($0) }, 5)
+        XCTAssertEqual(q.pop(upTo: 10) { popped.append($0) }, 0)
+        XCTAssertEqual(popped, Array(0..<7))
+    }
+
+    func testBatchConcurrent() {
+        let total = 100_000
+        let q = AtomicSPSCQueue<Int>(capacity: 64)
+        let producer = DispatchQueue(label: "tests.queue-producer")
+        let group = DispatchGroup()
+
+        producer.async(group: group) {
+            var next = 0
+            while next < total {
+                next += q.tryPush(contentsOf: next..<min(next + 16, total))
+            }
+        }
+
+        var expected = 0
+        while expected < total {
+            q.pop(upTo: 32) {
+                XCTAssertEqual($0, expected)
+                expected += 1
+            }
+        }
+        group.wait()
+        XCTAssertNil(q.pop())
+    }
+
+    func testPerformanceSPSC() {
+        let total = 1_000_000
+        measure {
+            let q = AtomicSPSCQueue<Int>(capacity: 1024)
+            let group = DispatchGroup()
+            DispatchQueue.global().async(group: group) {
+                for i in 0..<total {
+                    while !q.tryPush(i) {
+                        Atomic.hardwarePause()
+                    }
+                }
+            }
+            var count = 0
+            while count < total {
+                if q.pop() != nil {
+                    count += 1
+                }
+            }
+            group.wait()
+        }
+    }
 }
 
 final class AtomicBoundedSPMCQueueTests: XCTestCase {
@@ -155,4 +155,89 @@ final class AtomicRefTests: XCTestCase {
         XCTAssertNil(weakSomeInstance2)
         XCTAssertNil(weakSomeInstance3)
     }
+
+    func testGuardedStoreDefersRelease() {
+        class SomeClass {}
+        weak var weakSomeInstance: SomeClass?
+        let atomic = AtomicReference<SomeClass>()
+        ({
+            let someInstance = SomeClass()
+            weakSomeInstance = someInstance
+            Epoch.withPinned {
+                atomic.store(someInstance, guard: $0)
+            }
+        })()
+        Epoch.withPinned {
+            XCTAssert(atomic.load(guard: $0) === weakSomeInstance)
+            atomic.store(nil, guard: $0)
+            Epoch.collect() // reentrant
+            XCTAssertNotNil(weakSomeInstance)
+        }
+        // Advance the epoch enough times for the release to be run.
+        for _ in 0..<3 {
+            Epoch.collect()
+        }
+        XCTAssertNil(weakSomeInstance)
+    }
+
+    func testFewDeferredReleasesAreEventuallyRun() {
+        class SomeClass {}
+        weak var weakSomeInstance: SomeClass?
+        let atomic = AtomicReference<SomeClass>()
+        ({
+            let someInstance = SomeClass()
+            weakSomeInstance = someInstance
+            Epoch.withPinned {
+                atomic.store(someInstance, guard: $0)
+                atomic.store(nil, guard: $0)
+            }
+        })()
+        // Far fewer releases than would trigger a collection are pending,
+        // so pinning must eventually advance the epoch and run them.
+        for _ in 0..<1_000 where weakSomeInstance != nil {
+            Epoch.withPinned { _ in }
+        }
+        XCTAssertNil(weakSomeInstance)
+    }
+
+    func testGuardedConcurrentLoads() {
+        final class Config {
+            let a: Int
+            let b: Int
+            init(_ value: Int) {
+                a = value
+                b = value * 2
+            }
+        }
+        let iterations = 10_000
+        let atomic = AtomicReference(Config(0))
+        let q = DispatchQueue(label: "futures.test-atomic-ref", attributes: .concurrent)
+        let g = DispatchGroup()
+        let done = AtomicBool(false)
+
+        for _ in 0..<CPU_COUNT {
+            q.async(group: g, flags: .detached) {
+                while !done.load() {
+                    Epoch.withPinned {
+                        // swiftlint:disable:next force_unwrapping
+                        let config = atomic.load(guard: $0)!
+                        XCTAssertEqual(config.b, config.a * 2)
+                    }
+                }
+            }
+        }
+        q.async(group: g, flags: .detached) {
+            for i in 1...iterations {
+                Epoch.withPinned {
+                    atomic.store(Config(i), guard: $0)
+                }
+            }
+            done.store(true)
+        }
+        g.wait()
+
+        Epoch.withPinned {
+            XCTAssertEqual(atomic.load(guard: $0)?.a, iterations)
+        }
+    }
 }
@@ -84,6 +84,81 @@ final class AtomicValueTests: XCTestCase {
         XCTAssert(i.compareExchangeWeak(old, true) == old)
     }
 
+    func testDoubleWord() {
+        let w1 = DoubleWord(first: .max, second: 1)
+        let w2 = DoubleWord(first: 2, second: .max)
+        let i = AtomicDoubleWord(DoubleWord())
+        XCTAssertEqual(i.load(), DoubleWord())
+
+        i.store(w1)
+        XCTAssertEqual(i.load(), w1)
+        XCTAssertEqual(i.exchange(w2), w1)
+        XCTAssertEqual(i.load(), w2)
+
+        XCTAssertEqual(i.compareExchange(w1, w1), w2)
+        XCTAssertEqual(i.load(), w2)
+        XCTAssertEqual(i.compareExchange(w2, w1), w2)
+        XCTAssertEqual(i.load(), w1)
+
+        var j = w2
+        XCTAssertFalse(i.compareExchange(&j, w2))
+        XCTAssertEqual(j, w1)
+        while !i.compareExchangeWeak(&j, w2) {}
+        XCTAssertEqual(i.load(), w2)
+    }
+
+    func testDoubleWordConsistency() {
+        let PARTITIONS = 16
+        let ITERATIONS = 10_000
+
+        let q = DispatchQueue(label: "futures.test-atomic.double-word", attributes: .concurrent)
+        let g = DispatchGroup()
+
+        let counter = AtomicDoubleWord(DoubleWord())
+
+        for _ in 0..<PARTITIONS {
+            q.async(group: g, flags: .detached) {
+                for _ in 0..<ITERATIONS {
+                    var current = counter.load(order: .relaxed)
+                    while !counter.compareExchangeWeak(
+                        &current,
+                        DoubleWord(first: current.first + 1, second: current.second + 2)
+                    ) {}
+                }
+            }
+        }
+
+        g.wait()
+        let total = UInt(PARTITIONS * ITERATIONS)
+        XCTAssertEqual(counter.load(), DoubleWord(first: total, second: total * 2))
+    }
+
+    func testTaggedPointer() {
+        let a = UnsafeMutablePointer<Int>.allocate(capacity: 1)
+        let b = UnsafeMutablePointer<Int>.allocate(capacity: 1)
+        defer {
+            a.deallocate()
+            b.deallocate()
+        }
+        let p = AtomicTaggedPointer(TaggedPointer(a))
+        var stale = p.load()
+        XCTAssertEqual(stale.pointer, a)
+        XCTAssertEqual(stale.tag, 0)
+
+        // A -> B -> A
+        var current = stale
+        XCTAssert(p.compareExchange(&current, current.successor(b)))
+        current = p.load()
+        XCTAssert(p.compareExchange(&current, current.successor(a)))
+
+        // Same pointer, but the tag has moved on.
+        XCTAssertFalse(p.compareExchange(&stale, stale.successor(b)))
+        XCTAssertEqual(stale.pointer, a)
+        XCTAssertEqual(stale.tag, 2)
+        XCTAssertEqual(p.exchange(TaggedPointer(nil)), stale)
+        XCTAssertNil(p.load().pointer)
+    }
+
     func testInt() {
         let i = AtomicInt(0)
         XCTAssert(i.load() == 0)
@@ -141,6 +216,16 @@ final class AtomicValueTests: XCTestCase {
         while !i.compareExchangeWeak(&j, r3) {}
         XCTAssertEqual(r1, j)
         XCTAssertEqual(r3, i.load())
+
+        i.store(r1)
+        j = i.fetchMin(r2)
+        XCTAssertEqual(r1, j)
+        XCTAssertEqual(min(r1, r2), i.load())
+
+        i.store(r1)
+        j = i.fetchMax(r2)
+        XCTAssertEqual(r1, j)
+        XCTAssertEqual(max(r1, r2), i.load())
     }
 
     func testInt8() {
@@ -200,6 +285,16 @@ final class AtomicValueTests: XCTestCase {
         while !i.compareExchangeWeak(&j, r3) {}
         XCTAssertEqual(r1, j)
         XCTAssertEqual(r3, i.load())
+
+        i.store(r1)
+        j = i.fetchMin(r2)
+        XCTAssertEqual(r1, j)
+        XCTAssertEqual(min(r1, r2), i.load())
+
+        i.store(r1)
+        j = i.fetchMax(r2)
+        XCTAssertEqual(r1, j)
+        XCTAssertEqual(max(r1, r2), i.load())
     }
 
     func testInt16() {
@@ -259,6 +354,16 @@ final class AtomicValueTests: XCTestCase {
         while !i.compareExchangeWeak(&j, r3) {}
         XCTAssertEqual(r1, j)
         XCTAssertEqual(r3, i.load())
+
+        i.store(r1)
+        j = i.fetchMin(r2)
+        XCTAssertEqual(r1, j)
+        XCTAssertEqual(min(r1, r2), i.load())
+
+        i.store(r1)
+        j = i.fetchMax(r2)
+        XCTAssertEqual(r1, j)
+        XCTAssertEqual(max(r1, r2), i.load())
     }
 
     func testInt32() {
@@ -318,6 +423,16 @@ final class AtomicValueTests: XCTestCase {
         while !i.compareExchangeWeak(&j, r3) {}
         XCTAssertEqual(r1, j)
         XCTAssertEqual(r3, i.load())
+
+        i.store(r1)
+        j = i.fetchMin(r2)
+        XCTAssertEqual(r1, j)
+        XCTAssertEqual(min(r1, r2), i.load())
+
+        i.store(r1)
+        j = i.fetchMax(r2)
+        XCTAssertEqual(r1, j)
+        XCTAssertEqual(max(r1, r2), i.load())
     }
 
     func testInt64() {
@@ -377,6 +492,16 @@ final class AtomicValueTests: XCTestCase {
         while !i.compareExchangeWeak(&j, r3) {}
         XCTAssertEqual(r1, j)
         XCTAssertEqual(r3, i.load())
+
+        i.store(r1)
+        j = i.fetchMin(r2)
+        XCTAssertEqual(r1, j)
+        XCTAssertEqual(min(r1, r2), i.load())
+
+        i.store(r1)
+        j = i.fetchMax(r2)
+        XCTAssertEqual(r1, j)
+        XCTAssertEqual(max(r1, r2), i.load())
     }
 
     func testUInt() {
@@ -436,6 +561,16 @@ final class AtomicValueTests: XCTestCase {
         while !i.compareExchangeWeak(&j, r3) {}
         XCTAssertEqual(r1, j)
         XCTAssertEqual(r3, i.load())
+
+        i.store(r1)
+        j = i.fetchMin(r2)
+        XCTAssertEqual(r1, j)
+        XCTAssertEqual(min(r1, r2), i.load())
+
+        i.store(r1)
+        j = i.fetchMax(r2)
+        XCTAssertEqual(r1, j)
+        XCTAssertEqual(max(r1, r2), i.load())
     }
 
     func testUInt8() {
@@ -495,6 +630,16 @@ final class AtomicValueTests: XCTestCase {
         while !i.compareExchangeWeak(&j, r3) {}
         XCTAssertEqual(r1, j)
         XCTAssertEqual(r3, i.load())
+
+        i.store(r1)
+        j = i.fetchMin(r2)
+        XCTAssertEqual(r1, j)
+        XCTAssertEqual(min(r1, r2), i.load())
+
+        i.store(r1)
+        j = i.fetchMax(r2)
+        XCTAssertEqual(r1, j)
+        XCTAssertEqual(max(r1, r2), i.load())
     }
 
     func testUInt16() {
@@ -554,6 +699,16 @@ final class AtomicValueTests: XCTestCase {
         while !i.compareExchangeWeak(&j, r3) {}
         XCTAssertEqual(r1, j)
         XCTAssertEqual(r3, i.load())
+
+        i.store(r1)
+        j = i.fetchMin(r2)
+        XCTAssertEqual(r1, j)
+        XCTAssertEqual(min(r1, r2), i.load())
+
+        i.store(r1)
+        j = i.fetchMax(r2)
+        XCTAssertEqual(r1, j)
+        XCTAssertEqual(max(r1, r2), i.load())
     }
 
     func testUInt32() {
@@ -613,6 +768,16 @@ final class AtomicValueTests: XCTestCase {
         while !i.compareExchangeWeak(&j, r3) {}
         XCTAssertEqual(r1, j)
         XCTAssertEqual(r3, i.load())
+
+        i.store(r1)
+        j = i.fetchMin(r2)
+        XCTAssertEqual(r1, j)
+        XCTAssertEqual(min(r1, r2), i.load())
+
+        i.store(r1)
+        j = i.fetchMax(r2)
+        XCTAssertEqual(r1, j)
+        XCTAssertEqual(max(r1, r2), i.load())
     }
 
     func testUInt64() {
@@ -672,5 +837,115 @@ final class AtomicValueTests: XCTestCase {
         while !i.compareExchangeWeak(&j, r3) {}
         XCTAssertEqual(r1, j)
         XCTAssertEqual(r3, i.load())
+
+        i.store(r1)
+        j = i.fetchMin(r2)
+        XCTAssertEqual(r1, j)
+        XCTAssertEqual(min(r1, r2), i.load())
+
+        i.store(r1)
+        j = i.fetchMax(r2)
+        XCTAssertEqual(r1, j)
+        XCTAssertEqual(max(r1, r2), i.load())
+    }
+
+    func testFloat() {
+        let i = AtomicFloat(0)
+        XCTAssertEqual(i.load(), 0)
+
+        i.store(1.5)
+        XCTAssertEqual(i.exchange(-2.25), 1.5)
+        XCTAssertEqual(i.fetchAdd(4.5), -2.25)
+        XCTAssertEqual(i.fetchSub(0.25), 2.25)
+        XCTAssertEqual(i.load(), 2)
+
+        XCTAssertEqual(i.fetchMin(3), 2)
+        XCTAssertEqual(i.load(), 2)
+        XCTAssertEqual(i.fetchMin(-1), 2)
+        XCTAssertEqual(i.load(), -1)
+        XCTAssertEqual(i.fetchMax(-3), -1)
+        XCTAssertEqual(i.load(), -1)
+        XCTAssertEqual(i.fetchMax(.infinity), -1)
+        XCTAssertEqual(i.load(), .infinity)
+
+        XCTAssertEqual(i.compareExchange(0, 1), .infinity)
+        XCTAssertEqual(i.compareExchange(.infinity, 1), .infinity)
+        XCTAssertEqual(i.load(), 1)
+    }
+
+    func testFloatConsistency() {
+        let PARTITIONS = 16
+        let ITERATIONS = 10_000
+
+        let q = DispatchQueue(label: "futures.test-atomic.float", attributes: .concurrent)
+        let g = DispatchGroup()
+
+        let sum = AtomicFloat(0)
+        let maximum = AtomicFloat(-.infinity)
+
+        for p in 0..<PARTITIONS {
+            q.async(group: g, flags: .detached) {
+                for i in 0..<ITERATIONS {
+                    // Halves are exactly representable, so the sum must
+                    // not depend on the order of additions.
+                    sum.fetchAdd(0.5, order: .relaxed)
+                    maximum.fetchMax(Float(p * ITERATIONS + i), order: .relaxed)
+                }
+            }
+        }
+
+        g.wait()
+        XCTAssertEqual(sum.load(), Float(PARTITIONS * ITERATIONS) / 2)
+        XCTAssertEqual(maximum.load(), Float(PARTITIONS * ITERATIONS - 1))
+    }
+
+    func testDouble() {
+        let i = AtomicDouble(0)
+        XCTAssertEqual(i.load(), 0)
+
+        i.store(1.5)
+        XCTAssertEqual(i.exchange(-2.25), 1.5)
+        XCTAssertEqual(i.fetchAdd(4.5), -2.25)
+        XCTAssertEqual(i.fetchSub(0.25), 2.25)
+        XCTAssertEqual(i.load(), 2)
+
+        XCTAssertEqual(i.fetchMin(3), 2)
+        XCTAssertEqual(i.load(), 2)
+        XCTAssertEqual(i.fetchMin(-1), 2)
+        XCTAssertEqual(i.load(), -1)
+        XCTAssertEqual(i.fetchMax(-3), -1)
+        XCTAssertEqual(i.load(), -1)
+        XCTAssertEqual(i.fetchMax(.infinity), -1)
+        XCTAssertEqual(i.load(), .infinity)
+
+        XCTAssertEqual(i.compareExchange(0, 1), .infinity)
+        XCTAssertEqual(i.compareExchange(.infinity, 1), .infinity)
+        XCTAssertEqual(i.load(), 1)
+    }
+
+    func testDoubleConsistency() {
+        let PARTITIONS = 16
+        let ITERATIONS = 10_000
+
+        let q = DispatchQueue(label: "futures.test-atomic.double", attributes: .concurrent)
+        let g = DispatchGroup()
+
+        let sum = AtomicDouble(0)
+        let maximum = AtomicDouble(-.infinity)
+
+        for p in 0..<PARTITIONS {
+            q.async(group: g, flags: .detached) {
+                for i in 0..<ITERATIONS {
+                    // Halves are exactly representable, so the sum must
+                    // not depend on the order of additions.
+                    sum.fetchAdd(0.5, order: .relaxed)
+                    maximum.fetchMax(Double(p * ITERATIONS + i), order: .relaxed)
+                }
+            }
+        }
+
+        g.wait()
+        XCTAssertEqual(sum.load(), Double(PARTITIONS * ITERATIONS) / 2)
+        XCTAssertEqual(maximum.load(), Double(PARTITIONS * ITERATIONS - 1))
     }
 }
@@ -0,0 +1,83 @@
+//
+//  AtomicWideBitsetTests.swift
+//  Futures
+//
+//  Copyright © 2019 Akis Kesoglou. Licensed under the MIT license.
+//
+
+import FuturesSync
+import FuturesTestSupport
+import XCTest
+
+final class AtomicWideBitsetTests: XCTestCase {
+    func testBasic() {
+        let bitset = AtomicWideBitset(count: 10_000)
+        XCTAssert(bitset.isEmpty)
+
+        XCTAssert(bitset.set(0))
+        XCTAssertFalse(bitset.set(0))
+        XCTAssert(bitset.set(63))
+        XCTAssert(bitset.set(64))
+        XCTAssert(bitset.set(9_999))
+        XCTAssertFalse(bitset.isEmpty)
+
+        XCTAssert(bitset.test(64))
+        XCTAssertFalse(bitset.test(65))
+        XCTAssert(bitset.testAndClear(64))
+        XCTAssertFalse(bitset.testAndClear(64))
+        bitset.clear(63)
+        XCTAssertFalse(bitset.test(63))
+
+        var drained = [Int]()
+        bitset.drainSetBits { drained.append($0) }
+        XCTAssertEqual(drained, [0, 9_999])
+        XCTAssert(bitset.isEmpty)
+
+        drained.removeAll()
+        bitset.drainSetBits { drained.append($0) }
+        XCTAssertEqual(drained, [])
+    }
+
+    func testEmpty() {
+        let bitset = AtomicWideBitset(count: 0)
+        XCTAssert(bitset.isEmpty)
+        bitset.drainSetBits { _ in XCTFail() }
+    }
+
+    func testConcurrentSetAndDrain() {
+        let count = 10_000
+        let bitset = AtomicWideBitset(count: count)
+        let q = DispatchQueue(label: "futures.test-wide-bitset", attributes: .concurrent)
+        let g = DispatchGroup()
+        let producers = max(2, CPU_COUNT - 1)
+        let done = AtomicInt(0)
+
+        // Each producer sets a disjoint subset of bits exactly once.
+        for p in 0..<producers {
+            q.async(group: g, flags: .detached) {
+                for i in stride(from: p, to: count, by: producers) {
+                    bitset.set(i)
+                }
+                done.fetchAdd(1)
+            }
+        }
+
+        var seen = [Bool](repeating: false, count: count)
+        var total = 0
+        let drain = {
+            bitset.drainSetBits {
+                XCTAssertFalse(seen[$0])
+                seen[$0] = true
+                total += 1
+            }
+        }
+        while done.load() < producers {
+            drain()
+        }
+        g.wait()
+        drain()
+
+        XCTAssertEqual(total, count)
+        XCTAssert(bitset.isEmpty)
+    }
+}
@@ -0,0 +1,90 @@
+//
+//  BackoffTests.swift
+//  Futures
+//
+//  Copyright © 2019 Akis Kesoglou. Licensed under the MIT license.
+//
+
+import FuturesSync
+import FuturesTestSupport
+import XCTest
+
+final class BackoffTests: XCTestCase {
+    func testDefault() {
+        var backoff = Backoff()
+        var snoozes = 0
+        while !backoff.isComplete {
+            backoff.snooze()
+            snoozes += 1
+        }
+        XCTAssertEqual(snoozes, 11)
+        backoff.finish()
+    }
+
+    func testSiteAdaptsSpinLimit() {
+        guard CPU_COUNT > 1 else {
+            return // spinning is disabled on uniprocessor systems
+        }
+
+        let site = Backoff.Site("test")
+        XCTAssertEqual(site.spinLimit, 6)
+
+        // Loops that always run to completion make spinning pointless.
+        // Only one in 8 loops adapts the spin limit.
+        for _ in 0..<4_000 {
+            var backoff = Backoff(site: site)
+            while !backoff.isComplete {
+                backoff.snooze()
+            }
+            backoff.finish()
+        }
+        XCTAssertEqual(site.spinLimit, 1)
+
+        // Loops that finish right after the spin phase ask for more.
+        for _ in 0..<4_000 {
+            var backoff = Backoff(site: site)
+            for _ in 0...site.spinLimit {
+                backoff.snooze()
+            }
+            backoff.finish()
+        }
+        XCTAssertEqual(site.spinLimit, 10)
+
+        let stats = site.resetStatistics()
+        XCTAssertEqual(stats.spins, 8_000)
+        XCTAssertEqual(stats.yields, 4_000)
+        XCTAssertEqual(stats.parks, 0)
+        XCTAssertEqual(site.statistics, Backoff.Site.Statistics(spins: 0, yields: 0, parks: 0))
+    }
+
+    func testParkTimesOut() {
+        let site = Backoff.Site("test.park")
+        var flag = 0
+        var backoff = Backoff(site: site)
+        while !backoff.isComplete {
+            backoff.snooze()
+        }
+        // Nobody will wake us up; parking must still return.
+        backoff.snooze(parkingOn: &flag) { true }
+        backoff.snooze(parkingOn: &flag) { false }
+        XCTAssertEqual(site.statistics.parks, 1)
+    }
+
+    func testParkIsWoken() {
+        let ready = AtomicBool(false)
+        let address = UnsafeMutableRawPointer.allocate(byteCount: 1, alignment: 1)
+        defer { address.deallocate() }
+
+        let q = DispatchQueue(label: "futures.test-backoff.park")
+        let g = DispatchGroup()
+        q.async(group: g) {
+            var backoff = Backoff()
+            while !ready.load() {
+                backoff.snooze(parkingOn: address) { !ready.load() }
+            }
+        }
+        ready.store(true)
+        ParkingLot.unparkAll(address: address)
+        g.wait()
+    }
+}
@@ -0,0 +1,84 @@
+//
+//  BlockingQueueTests.swift
+//  Futures
+//
+//  Copyright © 2019 Akis Kesoglou. Licensed under the MIT license.
+//
+
+import FuturesSync
+import FuturesTestSupport
+import XCTest
+
+final class BlockingQueueTests: XCTestCase {
+    func testPopTimesOut() {
+        let q = BlockingQueue<Int>()
+        XCTAssertNil(q.pop())
+        XCTAssertNil(q.pop(timeout: 0))
+        XCTAssertNil(q.pop(timeout: 1_000_000))
+        q.push(1)
+        XCTAssertEqual(q.pop(timeout: 0), 1)
+        XCTAssert(q.isEmpty)
+    }
+
+    func testPushWakesWaiter() {
+        let q = BlockingQueue<Int>()
+        let g = DispatchGroup()
+        var popped: Int?
+        DispatchQueue.global().async(group: g) {
+            popped = q.pop(timeout: nil)
+        }
+        // Give the consumer a chance to park.
+        usleep(10_000)
+        q.push(42)
+        g.wait()
+        XCTAssertEqual(popped, 42)
+    }
+
+    func testDrain() {
+        let q = BlockingQueue<Int>()
+        XCTAssertEqual(q.drain(max: 10), [])
+        for i in 0..<5 {
+            q.push(i)
+        }
+        XCTAssertEqual(q.drain(max: 0), [])
+        XCTAssertEqual(q.drain(max: 3), [0, 1, 2])
+        XCTAssertEqual(q.drain(max: 10, timeout: nil), [3, 4])
+        XCTAssertEqual(q.drain(max: 10, timeout: 1_000_000), [])
+    }
+
+    func testConcurrent() {
+        let producers = max(2, CPU_COUNT / 2)
+        let consumers = max(2, CPU_COUNT / 2)
+        let iterations = 10_000
+        let q = BlockingQueue<Int>()
+        let sum = AtomicInt(0)
+        let g = DispatchGroup()
+        let pq = DispatchQueue(label: "tests.blocking-queue.producer", attributes: .concurrent)
+        let cq = DispatchQueue(label: "tests.blocking-queue.consumer", attributes: .concurrent)
+
+        for _ in 0..<consumers {
+            cq.async(group: g, flags: .detached) {
+                // -1 tells the consumer to stop.
+                while let value = q.pop(timeout: nil), value >= 0 {
+                    sum.fetchAdd(value, order: .relaxed)
+                }
+            }
+        }
+        for _ in 0..<producers {
+            pq.async(group: g, flags: .detached) {
+                for _ in 0..<iterations {
+                    q.push(1)
+                }
+            }
+        }
+        while sum.load() < producers * iterations {
+            usleep(1_000)
+        }
+        for _ in 0..<consumers {
+            q.push(-1)
+        }
+        g.wait()
+        XCTAssertEqual(sum.load(), producers * iterations)
+        XCTAssert(q.isEmpty)
+    }
+}
@@ -0,0 +1,112 @@
+//
+//  ConcurrentDictionaryTests.swift
+//  Futures
+//
+//  Copyright © 2019 Akis Kesoglou. Licensed under the MIT license.
+//
+
+import FuturesSync
+import FuturesTestSupport
+import XCTest
+
+final class ConcurrentDictionaryTests: XCTestCase {
+    func testBasic() {
+        let map = ConcurrentDictionary<Int, String>(shardCount: 4)
+        XCTAssert(map.isEmpty)
+        XCTAssertNil(map.updateValue("a", forKey: 1))
+        XCTAssertEqual(map.updateValue("b", forKey: 1), "a")
+        XCTAssertFalse(map.insertValue("c", forKey: 1))
+        XCTAssert(map.insertValue("c", forKey: 2))
+        XCTAssertEqual(map[1], "b")
+        XCTAssertEqual(map.value(forKey: 2), "c")
+        XCTAssertEqual(map.count, 2)
+
+        map[3] = "d"
+        map[2] = nil
+        XCTAssertEqual(map.dictionary(), [1: "b", 3: "d"])
+
+        XCTAssertEqual(map.removeValue(forKey: 1), "b")
+        XCTAssertNil(map.removeValue(forKey: 1))
+
+        map.compute(3) { $0 = nil }
+        map.compute(4) { $0 = ($0 ?? "") + "e" }
+        XCTAssertEqual(map.dictionary(), [4: "e"])
+
+        map.removeAll()
+        XCTAssert(map.isEmpty)
+    }
+
+    func testSingleShard() {
+        let map = ConcurrentDictionary<Int, Int>(shardCount: 1)
+        for i in 0..<100 {
+            map[i] = i
+        }
+        XCTAssertEqual(map.count, 100)
+    }
+
+    func testConcurrentCompute() {
+        let map = ConcurrentDictionary<Int, Int>()
+        let keys = 100
+        let iterations = 1_000
+        let q = DispatchQueue(label: "futures.test-concurrent-dictionary", attributes: .concurrent)
+        let g = DispatchGroup()
+
+        for _ in 0..<CPU_COUNT {
+            q.async(group: g, flags: .detached) {
+                for i in 0..<iterations {
+                    map.compute(i % keys) { $0 = ($0 ?? 0) + 1 }
+                }
+            }
+        }
+        g.wait()
+
+        XCTAssertEqual(map.count, keys)
+        var total = 0
+        map.forEach { total += $1 }
+        XCTAssertEqual(total, CPU_COUNT * iterations)
+    }
+
+    // MARK: - Benchmarks -
+
+    private let _benchmarkKeys = 1_000
+    private let _benchmarkIterations = 20_000
+
+    private func _benchmark(_ body: @escaping (Int) -> Void) {
+        let q = DispatchQueue(label: "futures.test-concurrent-dictionary.bench", attributes: .concurrent)
+        let g = DispatchGroup()
+        let keys = _benchmarkKeys
+        let iterations = _benchmarkIterations
+        measure {
+            for t in 0..<CPU_COUNT {
+                q.async(group: g, flags: .detached) {
+                    for i in 0..<iterations {
+                        body((i &* 31 &+ t) % keys)
+                    }
+                }
+            }
+            g.wait()
+        }
+    }
+
+    func testBenchmarkConcurrentDictionary() {
+        let map = ConcurrentDictionary<Int, Int>()
+        _benchmark { key in
+            if key & 3 == 0 {
+                map.compute(key) { $0 = ($0 ?? 0) + 1 }
+            } else {
+                _ = map[key]
+            }
+        }
+    }
+
+    func testBenchmarkMutexDictionary() {
+        let map = Mutex([Int: Int]())
+        _benchmark { key in
+            if key & 3 == 0 {
+                map.withMutableValue { $0[key] = ($0[key] ?? 0) + 1 }
+            } else {
+                _ = map.withMutableValue { $0[key] }
+            }
+        }
+    }
+}
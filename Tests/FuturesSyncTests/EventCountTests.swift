@@ -0,0 +1,101 @@
+//
+//  EventCountTests.swift
+//  Futures
+//
+//  Copyright © 2019 Akis Kesoglou. Licensed under the MIT license.
+//
+
+import FuturesSync
+import FuturesTestSupport
+import XCTest
+
+private func deadline(afterMilliseconds ms: Int) -> timespec {
+    var tv = timeval()
+    gettimeofday(&tv, nil)
+    let nsec = Int(tv.tv_usec) * 1_000 + ms * 1_000_000
+    return timespec(tv_sec: tv.tv_sec + nsec / 1_000_000_000, tv_nsec: nsec % 1_000_000_000)
+}
+
+final class EventCountTests: XCTestCase {
+    func testNotifyWithoutWaiters() {
+        let event = EventCount()
+        event.notifyOne()
+        event.notifyAll()
+        _ = event.prepareWait()
+        event.cancelWait()
+        event.notifyOne()
+        // Nobody is notifying us; waiting must time out.
+        let key = event.prepareWait()
+        XCTAssertFalse(event.commitWait(key, deadline: deadline(afterMilliseconds: 1)))
+    }
+
+    func testNotifyBeforeCommit() {
+        let event = EventCount()
+        let key = event.prepareWait()
+        event.notifyOne()
+        // A notification after `prepareWait()` means we must not block.
+        XCTAssert(event.commitWait(key))
+    }
+
+    func testNotifyWakesWaiter() {
+        let event = EventCount()
+        let ready = AtomicBool(false)
+        let g = DispatchGroup()
+        DispatchQueue.global().async(group: g) {
+            while !ready.load() {
+                let key = event.prepareWait()
+                if ready.load() {
+                    event.cancelWait()
+                    break
+                }
+                event.commitWait(key)
+            }
+        }
+        usleep(10_000)
+        ready.store(true)
+        event.notifyAll()
+        g.wait()
+    }
+
+    func testConcurrent() {
+        let threads = max(2, CPU_COUNT)
+        let iterations = 10_000
+        let event = EventCount()
+        let q = AtomicUnboundedMPMCQueue<Int>()
+        let sum = AtomicInt(0)
+        let g = DispatchGroup()
+        let consumers = DispatchQueue(label: "tests.event-count.consumer", attributes: .concurrent)
+        let producers = DispatchQueue(label: "tests.event-count.producer", attributes: .concurrent)
+
+        func pop() -> Int {
+            while true {
+                if let item = q.pop() {
+                    return item
+                }
+                let key = event.prepareWait()
+                if let item = q.pop() {
+                    event.cancelWait()
+                    return item
+                }
+                event.commitWait(key)
+            }
+        }
+
+        for _ in 0..<threads {
+            consumers.async(group: g, flags: .detached) {
+                for _ in 0..<iterations {
+                    sum.fetchAdd(pop(), order: .relaxed)
+                }
+            }
+            producers.async(group: g, flags: .detached) {
+                for _ in 0..<iterations {
+                    q.push(1)
+                    event.notifyOne()
+                }
+            }
+        }
+        g.wait()
+        XCTAssertEqual(sum.load(), threads * iterations)
+        XCTAssert(q.isEmpty)
+    }
+}
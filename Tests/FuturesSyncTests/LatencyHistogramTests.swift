@@ -0,0 +1,137 @@
+//
+//  LatencyHistogramTests.swift
+//  Futures
+//
+//  Copyright © 2019 Akis Kesoglou. Licensed under the MIT license.
+//
+
+import Dispatch
+import FuturesSync
+import XCTest
+
+final class LatencyHistogramTests: XCTestCase {
+    func testSmallValuesAreExact() {
+        let histogram = LatencyHistogram(precision: 3)
+        for value in 0..<16 {
+            histogram.record(UInt64(value))
+        }
+        let buckets = histogram.snapshot.buckets
+        XCTAssertEqual(buckets.count, 16)
+        for (value, bucket) in buckets.enumerated() {
+            XCTAssertEqual(bucket.range, UInt64(value)...UInt64(value))
+            XCTAssertEqual(bucket.count, 1)
+        }
+    }
+
+    func testPrecision() {
+        for precision in [1, 5, 10] {
+            let histogram = LatencyHistogram(precision: precision, maximum: .max)
+            var value: UInt64 = 1
+            while value < .max / 3 {
+                histogram.record(value)
+                let bucket = histogram.reset().buckets[0]
+                XCTAssert(bucket.range.contains(value))
+                let width = bucket.range.upperBound - bucket.range.lowerBound
+                XCTAssertLessThanOrEqual(width, bucket.range.lowerBound >> UInt64(precision))
+                value = value * 3 + 1
+            }
+        }
+    }
+
+    func testMaximum() {
+        let histogram = LatencyHistogram(maximum: 1_000)
+        histogram.record(.max)
+        let snapshot = histogram.snapshot
+        XCTAssertEqual(snapshot.count, 1)
+        XCTAssert(snapshot.buckets[0].range.contains(1_000))
+
+        let unbounded = LatencyHistogram(maximum: .max)
+        unbounded.record(.max)
+        XCTAssertEqual(unbounded.snapshot.max, .max)
+    }
+
+    func testPercentiles() {
+        let histogram = LatencyHistogram()
+        XCTAssertEqual(histogram.snapshot.percentile(50), 0)
+        XCTAssert(histogram.snapshot.isEmpty)
+
+        for value in 1...1_000 as ClosedRange<UInt64> {
+            histogram.record(value * 1_000)
+        }
+        let snapshot = histogram.snapshot
+        XCTAssertEqual(snapshot.count, 1_000)
+        for (percentile, expected) in [(0.0, 1_000.0), (50, 500_000), (90, 900_000), (99, 990_000), (100, 1_000_000)] {
+            let value = Double(snapshot.percentile(percentile))
+            XCTAssertGreaterThanOrEqual(value, expected)
+            XCTAssertLessThanOrEqual(value, expected * (1 + 1 / 32))
+        }
+        XCTAssertLessThanOrEqual(snapshot.min, 1_000)
+        XCTAssertGreaterThanOrEqual(snapshot.max, 1_000_000)
+        XCTAssertEqual(snapshot.mean, 500_500, accuracy: 500_500 / 32)
+    }
+
+    func testReset() {
+        let histogram = LatencyHistogram()
+        histogram.record(42)
+        histogram.record(42_000)
+        let snapshot = histogram.reset()
+        XCTAssertEqual(snapshot.count, 2)
+        XCTAssert(histogram.snapshot.isEmpty)
+        XCTAssertEqual(histogram.snapshot, LatencyHistogram.Snapshot())
+    }
+
+    func testMerge() {
+        let a = LatencyHistogram()
+        let b = LatencyHistogram(maximum: .max)
+        a.record(10)
+        b.record(10)
+        b.record(1 << 50)
+
+        var merged = LatencyHistogram.Snapshot()
+        merged.merge(a.snapshot)
+        merged.merge(b.snapshot)
+        XCTAssertEqual(merged.count, 3)
+        XCTAssertEqual(merged.buckets.first?.count, 2)
+        XCTAssertEqual(a.snapshot.merging(b.snapshot), merged)
+
+        // values over the maximum are recorded as the maximum
+        a.merge(b.snapshot)
+        let snapshot = a.snapshot
+        XCTAssertEqual(snapshot.count, 3)
+        XCTAssert(snapshot.buckets[1].range.contains(a.maximum))
+    }
+
+    func testConcurrentRecording() {
+        let iterations = 100_000
+        for shards in [1, StripedCounter.defaultStripes] {
+            let histogram = LatencyHistogram(shards: shards)
+            DispatchQueue.concurrentPerform(iterations: 4) { i in
+                for j in 0..<iterations {
+                    histogram.record(UInt64(i * j))
+                }
+            }
+            XCTAssertEqual(histogram.reset().count, 4 * iterations)
+        }
+    }
+
+    // MARK: Benchmarks
+
+    func testRecordPerformance() {
+        _measure(LatencyHistogram())
+    }
+
+    func testRecordShardedPerformance() {
+        _measure(LatencyHistogram(shards: StripedCounter.defaultStripes))
+    }
+
+    private func _measure(_ histogram: LatencyHistogram) {
+        let iterations = 1_000_000
+        measure {
+            DispatchQueue.concurrentPerform(iterations: 4) { _ in
+                for i in 0..<iterations {
+                    histogram.record(UInt64(truncatingIfNeeded: i))
+                }
+            }
+        }
+    }
+}
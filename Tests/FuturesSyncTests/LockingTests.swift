@@ -5,6 +5,7 @@
 //  Copyright © 2019 Akis Kesoglou. Licensed under the MIT license.
 //
 
+import Foundation
 import FuturesSync
 import FuturesTestSupport
 import XCTest
@@ -36,6 +37,9 @@ public final class LockingTests: XCTestCase {
         q.async(group: g) { self.lockTest(c, PosixLock()) }
         q.async(group: g) { self.lockTest(c, SpinLock()) }
         q.async(group: g) { self.lockTest(c, UnfairLock()) }
+        q.async(group: g) { self.lockTest(c, RawMutex()) }
+        q.async(group: g) { self.lockTest(c, RwLock()) }
+        q.async(group: g) { self.lockTest(c, ProfiledLock(SpinLock(), label: "test.contended")) }
         g.wait()
     }
 
@@ -47,6 +51,217 @@ public final class LockingTests: XCTestCase {
         q.async(group: g) { self.lockTest(c, PosixLock()) }
         q.async(group: g) { self.lockTest(c, SpinLock()) }
         q.async(group: g) { self.lockTest(c, UnfairLock()) }
+        q.async(group: g) { self.lockTest(c, RawMutex()) }
+        q.async(group: g) { self.lockTest(c, RwLock()) }
+        q.async(group: g) { self.lockTest(c, ProfiledLock(SpinLock(), label: "test.uncontended")) }
         g.wait()
     }
+
+    public func testProfiledLock() {
+        let profile = LockProfile(label: "test.profiled")
+        let lock = ProfiledLock(PosixLock(), profile: profile)
+
+        XCTAssert(lock.tryAcquire())
+        XCTAssertFalse(lock.tryAcquire())
+        lock.release()
+        lock.sync {}
+
+        let q = DispatchQueue(label: "futures.test-locking.profiled")
+        let g = DispatchGroup()
+        lock.acquire()
+        q.async(group: g) {
+            lock.sync {}
+        }
+        usleep(10_000)
+        lock.release()
+        g.wait()
+
+        let stats = profile.resetStatistics()
+        XCTAssertEqual(stats.label, "test.profiled")
+        XCTAssertEqual(stats.acquisitions, 4)
+        XCTAssertEqual(stats.contendedAcquisitions, 1)
+        XCTAssertEqual(stats.failedTryAcquisitions, 1)
+        XCTAssertGreaterThan(stats.spins, 0)
+        XCTAssertEqual(stats.waitTimes.count, 1)
+        XCTAssertGreaterThan(stats.waitTimes.percentile(50), 1_000_000)
+        XCTAssertEqual(stats.holdTimes.count, 4)
+        XCTAssertGreaterThan(stats.holdTimes.percentile(100), 1_000_000)
+
+        let reset = profile.statistics
+        XCTAssertEqual(reset.acquisitions, 0)
+        XCTAssertEqual(reset.holdTimes.count, 0)
+        XCTAssertEqual(reset.holdTimes.percentile(99), 0)
+    }
+
+    public func testLockProfiler() {
+        let profile = LockProfiler.profile(for: "test.profiler")
+        XCTAssert(LockProfiler.profile(for: "test.profiler") === profile)
+
+        let lock1 = ProfiledLock(UnfairLock(), label: "test.profiler")
+        let lock2 = ProfiledLock(SpinLock(), label: "test.profiler")
+        XCTAssert(lock1.profile === profile)
+        lock1.sync {}
+        lock2.sync {}
+
+        let stats = LockProfiler.statistics.first { $0.label == "test.profiler" }
+        XCTAssertEqual(stats?.acquisitions, 2)
+        XCTAssert(LockProfiler.report().contains("test.profiler: 2 acquisitions"))
+        LockProfiler.resetStatistics()
+        XCTAssertEqual(profile.statistics.acquisitions, 0)
+    }
+
+    public func testRawMutexFairRelease() {
+        let lock = RawMutex()
+        XCTAssert(lock.tryAcquire())
+        XCTAssert(lock.isLocked)
+        XCTAssertFalse(lock.tryAcquire())
+        lock.releaseFair()
+        XCTAssertFalse(lock.isLocked)
+        XCTAssert(lock.tryAcquire())
+        lock.release()
+    }
+
+    public func testRawCondvar() {
+        let lock = RawMutex()
+        let cond = RawCondvar()
+        let count = CPU_COUNT
+        var ready = false
+        var woken = 0
+
+        XCTAssertFalse(cond.signal())
+        XCTAssertEqual(cond.broadcast(), 0)
+
+        let q = DispatchQueue(label: "futures.test-locking.condvar", attributes: .concurrent)
+        let g = DispatchGroup()
+        for _ in 0..<count {
+            q.async(group: g, flags: .detached) {
+                lock.sync {
+                    while !ready {
+                        cond.wait(lock)
+                    }
+                    woken += 1
+                }
+            }
+        }
+
+        lock.sync {
+            ready = true
+            cond.broadcast()
+        }
+        g.wait()
+        XCTAssertEqual(woken, count)
+    }
+
+    public func testRawCondvarTimeout() {
+        let lock = RawMutex()
+        let cond = RawCondvar()
+        var tv = timeval()
+        gettimeofday(&tv, nil)
+        let deadline = timespec(tv_sec: tv.tv_sec, tv_nsec: Int(tv.tv_usec) * 1_000)
+        lock.sync {
+            XCTAssertFalse(cond.wait(lock, until: deadline))
+        }
+        XCTAssertFalse(lock.isLocked)
+    }
+
+    public func testSeqLock() {
+        struct Pair {
+            var a: Int
+            var b: Int
+            var c: Int8
+        }
+
+        let lock = SeqLock(Pair(a: 0, b: 0, c: 0))
+        let iterations = 10_000
+        let q = DispatchQueue(label: "futures.test-locking.seqlock", attributes: .concurrent)
+        let g = DispatchGroup()
+
+        for _ in 0..<2 {
+            q.async(group: g, flags: .detached) {
+                for _ in 0..<iterations {
+                    lock.update {
+                        $0.a += 1
+                        $0.b = $0.a * 2
+                        $0.c = Int8(truncatingIfNeeded: $0.a)
+                    }
+                }
+            }
+        }
+        for _ in 0..<CPU_COUNT {
+            q.async(group: g, flags: .detached) {
+                for _ in 0..<iterations {
+                    let pair = lock.load()
+                    XCTAssertEqual(pair.b, pair.a * 2)
+                    XCTAssertEqual(pair.c, Int8(truncatingIfNeeded: pair.a))
+                }
+            }
+        }
+        g.wait()
+
+        let pair = lock.load()
+        XCTAssertEqual(pair.a, iterations * 2)
+        XCTAssertEqual(lock.version, UInt(iterations * 2 * 2))
+    }
+
+    public func testRwLock() {
+        let lock = RwLock()
+        XCTAssert(lock.tryAcquireShared())
+        XCTAssert(lock.tryAcquireShared())
+        XCTAssertFalse(lock.tryAcquire())
+        lock.releaseShared()
+        lock.releaseShared()
+        XCTAssert(lock.tryAcquire())
+        XCTAssertFalse(lock.tryAcquireShared())
+        XCTAssertFalse(lock.tryAcquire())
+        lock.release()
+        XCTAssertEqual(lock.syncShared { 42 }, 42)
+    }
+
+    public func testRwLockReadersAndWriters() {
+        let table = Mutex([Int](repeating: 0, count: 16), lock: RwLock())
+        let iterations = 10_000
+        let q = DispatchQueue(label: "futures.test-locking.rwlock", attributes: .concurrent)
+        let g = DispatchGroup()
+
+        for _ in 0..<2 {
+            q.async(group: g, flags: .detached) {
+                for _ in 0..<iterations / 10 {
+                    table.withMutableValue {
+                        for i in $0.indices {
+                            $0[i] += 1
+                        }
+                    }
+                }
+            }
+        }
+        for _ in 0..<CPU_COUNT {
+            q.async(group: g, flags: .detached) {
+                for _ in 0..<iterations {
+                    table.withValue {
+                        XCTAssertEqual(Set($0).count, 1)
+                    }
+                }
+            }
+        }
+        g.wait()
+        XCTAssertEqual(table.load(), [Int](repeating: iterations / 10 * 2, count: 16))
+    }
+
+    public func testRwLockReadPerformance() {
+        let lock = RwLock()
+        let iterations = 100_000
+        let q = DispatchQueue(label: "futures.test-locking.rwlock-perf", attributes: .concurrent)
+        measure {
+            let g = DispatchGroup()
+            for _ in 0..<CPU_COUNT {
+                q.async(group: g, flags: .detached) {
+                    for _ in 0..<iterations {
+                        lock.acquireShared()
+                        lock.releaseShared()
+                    }
+                }
+            }
+            g.wait()
+        }
+    }
 }
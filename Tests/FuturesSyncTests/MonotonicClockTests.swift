@@ -0,0 +1,90 @@
+//
+//  MonotonicClockTests.swift
+//  Futures
+//
+//  Copyright © 2019 Akis Kesoglou. Licensed under the MIT license.
+//
+
+import Foundation
+import FuturesSync
+import XCTest
+
+final class MonotonicClockTests: XCTestCase {
+    private let _clocks: [MonotonicClock] = [.monotonic, .coarse, .cycles]
+
+    func testMonotonic() {
+        for clock in _clocks {
+            var last = clock.now()
+            for _ in 0..<10_000 {
+                let now = clock.now()
+                XCTAssertGreaterThanOrEqual(now, last, "\(clock)")
+                last = now
+            }
+        }
+    }
+
+    func testClocksAgree() {
+        // Allow for the coarse clock lagging behind and for calibration
+        // error accumulating over the lifetime of the process.
+        let tolerance = MonotonicClock.coarseResolution + 10_000_000
+        let monotonic = MonotonicClock.monotonic.now()
+        for clock in _clocks {
+            let now = clock.now()
+            XCTAssertLessThan(max(now, monotonic) - min(now, monotonic), tolerance, "\(clock)")
+        }
+    }
+
+    func testCyclesMeasureElapsedTime() {
+        let start = MonotonicClock.cycles.now()
+        let monotonicStart = MonotonicClock.monotonic.now()
+        usleep(20_000)
+        let elapsed = MonotonicClock.cycles.now() - start
+        let monotonicElapsed = MonotonicClock.monotonic.now() - monotonicStart
+        XCTAssertGreaterThanOrEqual(monotonicElapsed, 20_000_000)
+        XCTAssertEqual(Double(elapsed), Double(monotonicElapsed), accuracy: Double(monotonicElapsed) * 0.05)
+    }
+
+    func testTickTime() {
+        let time = MonotonicClock.refreshTickTime()
+        XCTAssertEqual(MonotonicClock.tickTime, time)
+        usleep(1_000)
+        XCTAssertEqual(MonotonicClock.tickTime, time)
+        XCTAssertGreaterThan(MonotonicClock.refreshTickTime(), time)
+    }
+
+    // MARK: Benchmarks
+
+    func testMonotonicPerformance() {
+        _measure(.monotonic)
+    }
+
+    func testCoarsePerformance() {
+        _measure(.coarse)
+    }
+
+    func testCyclesPerformance() {
+        _measure(.cycles)
+    }
+
+    func testTickTimePerformance() {
+        let iterations = 1_000_000
+        measure {
+            var sum: UInt64 = 0
+            for _ in 0..<iterations {
+                sum &+= MonotonicClock.tickTime
+            }
+            XCTAssertNotEqual(sum, 0)
+        }
+    }
+
+    private func _measure(_ clock: MonotonicClock) {
+        let iterations = 1_000_000
+        measure {
+            var sum: UInt64 = 0
+            for _ in 0..<iterations {
+                sum &+= clock.now()
+            }
+            XCTAssertNotEqual(sum, 0)
+        }
+    }
+}
@@ -0,0 +1,47 @@
+//
+//  StripedCounterTests.swift
+//  Futures
+//
+//  Copyright © 2019 Akis Kesoglou. Licensed under the MIT license.
+//
+
+import FuturesSync
+import FuturesTestSupport
+import XCTest
+
+final class StripedCounterTests: XCTestCase {
+    func testBasic() {
+        let counter = StripedCounter(stripes: 4)
+        XCTAssertEqual(counter.stripes, 4)
+        XCTAssertEqual(counter.sum, 0)
+        counter.increment()
+        counter.increment(by: 10)
+        counter.decrement(by: 3)
+        XCTAssertEqual(counter.sum, 8)
+        XCTAssertEqual(counter.reset(), 8)
+        XCTAssertEqual(counter.sum, 0)
+    }
+
+    func testConsistency() {
+        let PARTITIONS = 128
+        let ITERATIONS = 10_000
+        let total = (PARTITIONS * (PARTITIONS + 1) / 2) * ITERATIONS
+
+        let q = DispatchQueue(label: "futures.test-striped-counter", attributes: .concurrent)
+        let g = DispatchGroup()
+
+        let counter = StripedCounter()
+        XCTAssertEqual(counter.stripes, StripedCounter.defaultStripes)
+
+        for p in 1...PARTITIONS {
+            q.async(group: g, flags: .detached) {
+                for _ in 0..<ITERATIONS {
+                    counter.increment(by: p)
+                }
+            }
+        }
+
+        g.wait()
+        XCTAssertEqual(counter.sum, total)
+    }
+}
@@ -0,0 +1,127 @@
+//
+//  ThreadRuntimeTests.swift
+//  Futures
+//
+//  Copyright © 2019 Akis Kesoglou. Licensed under the MIT license.
+//
+
+import Foundation
+import FuturesSync
+import XCTest
+
+private final class Executor {}
+
+private final class Cache {}
+
+private let _threadLocalIndex = ThreadLocal { 0 }
+
+final class ThreadRuntimeTests: XCTestCase {
+    func testThreadIndex() {
+        let index = ThreadRuntime.threadIndex
+        XCTAssertGreaterThanOrEqual(index, 0)
+        XCTAssertEqual(ThreadRuntime.threadIndex, index)
+
+        var other = -1
+        _run { other = ThreadRuntime.threadIndex }
+        XCTAssertGreaterThanOrEqual(other, 0)
+        XCTAssertNotEqual(other, index)
+    }
+
+    func testWorkerIndex() {
+        XCTAssertNil(ThreadRuntime.workerIndex)
+        ThreadRuntime.workerIndex = 3
+        XCTAssertEqual(ThreadRuntime.workerIndex, 3)
+
+        var other: Int? = 0
+        _run { other = ThreadRuntime.workerIndex }
+        XCTAssertNil(other)
+
+        ThreadRuntime.workerIndex = nil
+        XCTAssertNil(ThreadRuntime.workerIndex)
+    }
+
+    func testCPU() {
+        let cpu = ThreadRuntime.currentCPU
+        XCTAssertEqual(ThreadRuntime.lastCPU, cpu)
+        #if os(Linux)
+        XCTAssertNotNil(cpu)
+        #endif
+        if let cpu = cpu {
+            XCTAssertGreaterThanOrEqual(cpu, 0)
+        }
+    }
+
+    func testExecutorIsReleasedOnThreadExit() {
+        weak var weakExecutor: Executor?
+        var same = false
+        _run {
+            let executor = ThreadRuntime.executor(Executor.self) { Executor() }
+            same = ThreadRuntime.executor(Executor.self) { Executor() } === executor
+            weakExecutor = executor
+        }
+        XCTAssert(same)
+
+        // The thread may still be tearing down its thread-local state.
+        let deadline = Date(timeIntervalSinceNow: 5)
+        while weakExecutor != nil, Date() < deadline {
+            usleep(1_000)
+        }
+        XCTAssertNil(weakExecutor)
+    }
+
+    func testCacheIsPerThread() {
+        let cache = ThreadRuntime.cache(Cache.self) { Cache() }
+        XCTAssert(ThreadRuntime.cache(Cache.self) { Cache() } === cache)
+
+        weak var weakOther: Cache?
+        var same = true
+        _run {
+            let other = ThreadRuntime.cache(Cache.self) { Cache() }
+            same = other === cache
+            weakOther = other
+        }
+        XCTAssertFalse(same)
+
+        // The thread may still be tearing down its thread-local state.
+        let deadline = Date(timeIntervalSinceNow: 5)
+        while weakOther != nil, Date() < deadline {
+            usleep(1_000)
+        }
+        XCTAssertNil(weakOther)
+    }
+
+    // MARK: Benchmarks
+
+    func testThreadIndexPerformance() {
+        let iterations = 1_000_000
+        measure {
+            var sum = 0
+            for _ in 0..<iterations {
+                sum &+= ThreadRuntime.threadIndex
+            }
+            XCTAssertNotEqual(sum, -1)
+        }
+    }
+
+    func testThreadLocalPerformance() {
+        let iterations = 1_000_000
+        measure {
+            var sum = 0
+            for _ in 0..<iterations {
+                sum &+= _threadLocalIndex.value
+            }
+            XCTAssertNotEqual(sum, -1)
+        }
+    }
+
+    /// Runs `body` on a new thread and waits for it to return.
+    private func _run(_ body: @escaping () -> Void) {
+        let done = DispatchSemaphore(value: 0)
+        let thread = Thread {
+            body()
+            done.signal()
+        }
+        thread.start()
+        done.wait()
+    }
+}
@@ -5,7 +5,7 @@
 //  Copyright © 2019 Akis Kesoglou. Licensed under the MIT license.
 //
 
-import Futures
+@testable import Futures
 import FuturesTestSupport
 import XCTest
 
@@ -59,6 +59,20 @@ final class SerialQueueExecutorTests: XCTestCase {
             executor.resume()
         }
     }
+
+    func testIsCurrent() {
+        let executor = QueueExecutor(label: "tests.serial")
+        let other = QueueExecutor(label: "tests.serial.other")
+        XCTAssertFalse(executor.isCurrent)
+        expect { exp in
+            executor.submit(lazy {
+                XCTAssert(executor.isCurrent)
+                XCTAssertFalse(other.isCurrent)
+                exp[0].fulfill()
+                return DONE
+            })
+        }
+    }
 }
 
 final class ConcurrentQueueExecutorTests: XCTestCase {
@@ -86,6 +100,45 @@ final class ThreadExecutorTests: XCTestCase {
         }
     }
 
+    func testThenRunsInline() throws {
+        let executor = ThreadExecutor.current
+        var depth = -1
+        try executor.submit(makeFuture(()).then(on: executor) {
+            lazy {
+                depth = InlineExecution.depth
+                return DONE
+            }
+        }.ignoreOutput())
+        XCTAssert(executor.run())
+        XCTAssertEqual(depth, 1)
+    }
+
+    func testPollOnRunsInline() throws {
+        let executor = ThreadExecutor.current
+        var depth = -1
+        try executor.submit(lazy { () -> Void in
+            depth = InlineExecution.depth
+            return DONE
+        }.poll(on: executor).ignoreOutput())
+        XCTAssert(executor.run())
+        XCTAssertEqual(depth, 1)
+    }
+
+    func testInlineMaxDepth() throws {
+        let maxDepth = InlineExecution.maxDepth
+        InlineExecution.maxDepth = 0
+        defer { InlineExecution.maxDepth = maxDepth }
+
+        let executor = ThreadExecutor.current
+        var depth = -1
+        try executor.submit(lazy { () -> Void in
+            depth = InlineExecution.depth
+            return DONE
+        }.poll(on: executor).ignoreOutput())
+        XCTAssert(executor.run())
+        XCTAssertEqual(depth, 0)
+    }
+
     func testRunNested() throws {
         var count = 0
         let executor = ThreadExecutor.current
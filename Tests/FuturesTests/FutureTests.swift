@@ -5,10 +5,25 @@
 //  Copyright © 2019 Akis Kesoglou. Licensed under the MIT license.
 //
 
-import Futures
+@testable import Futures
 import FuturesTestSupport
 import XCTest
 
+/// A future that is pending for the given number of polls, without
+/// scheduling a wakeup, and then completes; `Payload` pads it to a size.
+private struct Countdown<Payload>: FutureProtocol {
+    var remaining: Int
+    let payload: Payload
+
+    mutating func poll(_ context: inout Context) -> Poll<Int> {
+        if remaining == 0 {
+            return .ready(42)
+        }
+        remaining -= 1
+        return .pending
+    }
+}
+
 final class FutureTests: XCTestCase {
     func testDeferred() {
         var f = Deferred<Int> {
@@ -102,6 +117,38 @@ final class FutureTests: XCTestCase {
         XCTAssertEqual(f.wait(), 42)
     }
 
+    func testAnyFutureCopiesAreIndependent() {
+        // stored inline
+        _testAnyFutureCopies(Countdown(remaining: 1, payload: ()))
+        // boxed
+        _testAnyFutureCopies(Countdown(remaining: 1, payload: (0, 0, 0, 0)))
+    }
+
+    private func _testAnyFutureCopies<P>(_ future: Countdown<P>, file: StaticString = #file, line: UInt = #line) {
+        poll { context in
+            var a = AnyFuture(future)
+            XCTAssertEqual(a.poll(&context), .pending, file: file, line: line)
+            var b = a
+            XCTAssertEqual(a.poll(&context), .ready(42), file: file, line: line)
+            XCTAssertEqual(b.poll(&context), .ready(42), file: file, line: line)
+
+            var c = AnyFuture(future)
+            var d = c
+            XCTAssertEqual(c.poll(&context), .pending, file: file, line: line)
+            XCTAssertEqual(c.poll(&context), .ready(42), file: file, line: line)
+            XCTAssertEqual(d.poll(&context), .pending, file: file, line: line)
+            XCTAssertEqual(d.poll(&context), .ready(42), file: file, line: line)
+            return .ready
+        }
+    }
+
+    func testAnyFutureDoesNotRewrap() {
+        let f = AnyFuture(AnyFuture(Countdown(remaining: 0, payload: ())))
+        XCTAssert(f._storage is _ErasedFuture<Countdown<Void>>)
+        let g = AnyFuture(AnyFuture<Int> { _ in .ready(42) })
+        XCTAssert(g._storage is _ErasedPollFn<Int>)
+    }
+
     // TODO: testMulticast()
     // TODO: testEraseToAnyMulticastFuture()
     // TODO: testShare()
@@ -307,6 +354,28 @@ final class FutureTests: XCTestCase {
         }
     }
 
+    func testSelectAnySelfWakingFuture() {
+        for _ in 0..<2 {
+            let waker = Ref<WakerProtocol?>(nil)
+            do {
+                var f = Future.selectAny([
+                    AnyFuture<Int> { context in
+                        waker.value = context.waker
+                        return .pending
+                    },
+                    AnyFuture<Int> { context in
+                        context.waker.signal()
+                        return .ready(2)
+                    },
+                ])
+                XCTAssertEqual(f.wait(), 2)
+                // queue the pending future behind the completed one
+                waker.value?.signal()
+            }
+            XCTAssertNotNil(waker.value)
+        }
+    }
+
     func testSelect() {
         do {
             let a = Future.ready(1)
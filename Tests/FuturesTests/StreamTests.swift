@@ -7,11 +7,27 @@
 
 // swiftlint:disable force_unwrapping
 
-import Futures
+@testable import Futures
 import FuturesSync
 import FuturesTestSupport
 import XCTest
 
+/// A stream that yields the integers up to `limit`, without ever being
+/// pending; `Payload` pads it to a size.
+private struct Counter<Payload>: StreamProtocol {
+    var next: Int
+    let limit: Int
+    let payload: Payload
+
+    mutating func pollNext(_ context: inout Context) -> Poll<Int?> {
+        if next == limit {
+            return .ready(nil)
+        }
+        next += 1
+        return .ready(next - 1)
+    }
+}
+
 final class StreamTests: XCTestCase {
     func testNever() throws {
         let s = Stream.never(outputType: Void.self)
@@ -192,6 +208,16 @@ final class StreamTests: XCTestCase {
         XCTAssertNil(s.next())
     }
 
+    func testPollOnCurrentExecutor() throws {
+        let executor = ThreadExecutor.current
+        var depths = [Int]()
+        try executor.submit(makeStream(0..<3).map { _ in
+            depths.append(InlineExecution.depth)
+        }.poll(on: executor).ignoreOutput())
+        XCTAssert(executor.run())
+        XCTAssertEqual(depths, [1, 1, 1])
+    }
+
     // TODO: testYield()
 
     // MARK: -
@@ -226,6 +252,30 @@ final class StreamTests: XCTestCase {
         }
     }
 
+    func testAnyStreamCopiesAreIndependent() {
+        // stored inline
+        _testAnyStreamCopies(Counter(next: 0, limit: 2, payload: ()))
+        // boxed
+        _testAnyStreamCopies(Counter(next: 0, limit: 2, payload: (0, 0, 0, 0)))
+    }
+
+    private func _testAnyStreamCopies<P>(_ stream: Counter<P>, file: StaticString = #file, line: UInt = #line) {
+        var a = AnyStream(stream)
+        XCTAssertEqual(a.next(), 0, file: file, line: line)
+        var b = a
+        XCTAssertEqual(a.next(), 1, file: file, line: line)
+        XCTAssertNil(a.next(), file: file, line: line)
+        XCTAssertEqual(b.next(), 1, file: file, line: line)
+        XCTAssertNil(b.next(), file: file, line: line)
+    }
+
+    func testAnyStreamDoesNotRewrap() {
+        let s = AnyStream(AnyStream(Counter(next: 0, limit: 0, payload: ())))
+        XCTAssert(s._storage is _ErasedStream<Counter<Void>>)
+        let t = AnyStream(AnyStream<Int> { _ in .ready(nil) })
+        XCTAssert(t._storage is _ErasedPollNextFn<Int>)
+    }
+
     func _testMulticastBasic<U: StreamConvertible>(_ constructor: (TestStream<Range<Int>>) -> U) where U.StreamType: Cancellable, U.StreamType.Output == Int {
         do {
             let m = constructor(makeStream(0..<3))
@@ -354,6 +404,24 @@ final class StreamTests: XCTestCase {
         try _testShare { $0.eraseToAnySharedStream() }
     }
 
+    func testReplayLast() {
+        let constructors: [(TestStream<Range<Int>>) -> AnyMulticastStream<Int>] = [
+            { $0.multicast(replay: .last(3)).eraseToAnyMulticastStream() },
+            { $0.share(replay: .last(3)).eraseToAnyMulticastStream() },
+        ]
+        for constructor in constructors {
+            let m = constructor(makeStream(0..<10))
+            var s1 = m.makeStream()
+            for i in 0..<5 {
+                XCTAssertEqual(s1.next(), i)
+            }
+            var s2 = m.makeStream()
+            XCTAssertEqual(s2.next(), 2)
+            XCTAssertEqual(s2.next(), 3)
+            XCTAssertEqual(s2.next(), 4)
+        }
+    }
+
     // MARK: -
 
     func testMap() {
@@ -1301,4 +1369,34 @@ final class StreamTests: XCTestCase {
     // TODO: testHandleEvents()
     // TODO: testPrint()
     // TODO: testBreakpointOnError()
+
+    func testInstrument() {
+        var s = makeStream(0..<3, yieldOnIndex: 1)
+            .instrument(label: "StreamTests.instrument.source")
+            .map { $0 * 2 }
+            .instrument(label: "StreamTests.instrument.map")
+        XCTAssertEqual(s.next(), 0)
+        XCTAssertEqual(s.next(), 2)
+        XCTAssertEqual(s.next(), 4)
+        XCTAssertNil(s.next())
+
+        let statistics = StreamProfiler.statistics(prefix: "StreamTests.instrument.")
+        XCTAssertEqual(statistics.map { $0.label }, [
+            "StreamTests.instrument.source",
+            "StreamTests.instrument.map",
+        ])
+        for stats in statistics {
+            XCTAssertEqual(stats.elements, 3)
+            XCTAssertEqual(stats.polls, 5)
+            XCTAssertEqual(stats.pendingPolls, 1)
+            XCTAssertEqual(stats.latencies.count, 3)
+            XCTAssertEqual(stats.pollTimes.count, 5)
+        }
+
+        let report = StreamProfiler.report(prefix: "StreamTests.instrument.")
+        XCTAssert(report.hasPrefix("StreamTests.instrument.source: 3 elements"))
+
+        StreamProfiler.resetStatistics(prefix: "StreamTests.instrument.")
+        XCTAssertEqual(StreamProfiler.profile(for: "StreamTests.instrument.map").statistics.polls, 0)
+    }
 }